@@ -60,7 +60,14 @@
 import Conduit.Core
 import Conduit.Channel
 import Conduit.Channel.Combinators
+import Conduit.Channel.Pipeline
+import Conduit.Channel.Sharded
+import Conduit.Channel.Scalar
+import Conduit.Channel.Bytes
+import Conduit.Channel.Shm
 import Conduit.Select.Types
 import Conduit.Select
 import Conduit.Select.DSL
 import Conduit.Broadcast
+import Conduit.Rendezvous
+import Conduit.Telemetry
@@ -13,6 +13,21 @@ namespace Broadcast
 
 variable {α : Type}
 
+/-- One-call fan-out: append `value` to every open channel in `subs` that has
+    space, taking one reference per delivery instead of paying a full send
+    round trip through the ABI per subscriber. Returns the indices of
+    subscribers that were full (in order); callers fall back to `send` for
+    those, preserving backpressure semantics. -/
+@[extern "conduit_broadcast_send"]
+opaque sendToAll (subs : @& Array (Channel α)) (value : α) : IO (Array Nat)
+
+/-- Deliver one value to every subscriber: bulk fan-out first, then a
+    blocking send to each subscriber that was full. -/
+private def distribute (subs : Array (Channel α)) (v : α) : IO Unit := do
+  let full ← sendToAll subs v
+  for i in full do
+    let _ ← subs[i]!.send v
+
 /-- Create a broadcast from a source channel with a fixed number of subscribers.
     Each subscriber channel receives all values from the source.
     When the source closes, all subscriber channels close. -/
@@ -29,17 +44,33 @@ def create (source : Channel α) (numSubscribers : Nat)
   let subs := subscribers
   let _ ← IO.asTask (prio := .dedicated) do
     Channel.forEach source fun v => do
-      for sub in subs do
-        let _ ← sub.send v
+      distribute subs v
     -- Close all subscribers when source exhausted
     for sub in subs do
       sub.close
   pure subscribers
 
+/-- Overflow policy for a hub subscriber: what the distributor does when the
+    subscriber's buffer is full. -/
+inductive OverflowPolicy where
+  /-- Send blocks until the subscriber has space (default). A slow subscriber
+      applies backpressure to the whole hub. -/
+  | block
+  /-- Overwrite the oldest buffered value; newest data wins. Evictions are
+      counted in the subscriber channel's `dropped` counter. -/
+  | dropOldest
+  /-- Keep only the latest value (a capacity-1 slot). -/
+  | conflate
+  deriving Repr, BEq, Inhabited
+
 /-- A broadcast hub allowing dynamic subscriber addition.
     Subscribers added after values are sent will only receive future values. -/
 structure HubState (α : Type) where
-  subscribers : Array (Channel α)
+  /-- Subscribers delivered with blocking sends. -/
+  blocking : Array (Channel α)
+  /-- Subscribers delivered with overwrite-on-full sends
+      (`dropOldest` and `conflate`). -/
+  lossy : Array (Channel α)
   closed : Bool
 
 structure Hub (α : Type) where
@@ -51,30 +82,43 @@ structure Hub (α : Type) where
     Subscribers can be added dynamically with `Hub.subscribe`.
     New subscribers will receive all future values from the point of subscription. -/
 def hub (source : Channel α) (bufferSize : Nat := 16) : IO (Hub α) := do
-  let state ← IO.mkRef { subscribers := (#[] : Array (Channel α)), closed := false }
+  let state ← IO.mkRef
+    { blocking := (#[] : Array (Channel α))
+      lossy := (#[] : Array (Channel α))
+      closed := false }
   let h : Hub α := ⟨state, bufferSize⟩
   -- Spawn distributor task
   let _ ← IO.asTask (prio := .dedicated) do
     Channel.forEach source fun v => do
-      let currentSubs := (← state.get).subscribers
-      for sub in currentSubs do
-        let _ ← sub.send v
+      let st ← state.get
+      distribute st.blocking v
+      for sub in st.lossy do
+        let _ ← sub.sendOverwrite v
     -- Mark closed and close all current subscribers
-    let currentSubs ← state.modifyGet fun st =>
-      (st.subscribers, { st with closed := true })
-    for sub in currentSubs do
+    let st ← state.modifyGet fun st =>
+      (st, { st with closed := true })
+    for sub in st.blocking do
+      sub.close
+    for sub in st.lossy do
       sub.close
   pure h
 
 /-- Subscribe to the hub, receiving all future values.
+    `policy` chooses what happens when this subscriber's buffer is full:
+    `block` (the default) applies backpressure to the whole hub, while
+    `dropOldest` and `conflate` drop data locally so one slow consumer
+    cannot stall delivery to everyone else.
     Returns none if the hub is already closed. -/
-def Hub.subscribe (h : Hub α) : IO (Option (Channel α)) := do
-  let ch ← Channel.newBuffered α h.bufferSize
+def Hub.subscribe (h : Hub α) (policy : OverflowPolicy := .block) : IO (Option (Channel α)) := do
+  let ch ← match policy with
+    | .conflate => Channel.newBuffered α 1
+    | _ => Channel.newBuffered α h.bufferSize
   let added ← h.state.modifyGet fun st =>
     if st.closed then
       (false, st)
-    else
-      (true, { st with subscribers := st.subscribers.push ch })
+    else match policy with
+      | .block => (true, { st with blocking := st.blocking.push ch })
+      | _ => (true, { st with lossy := st.lossy.push ch })
   if added then
     return some ch
   ch.close
@@ -87,7 +131,7 @@ def Hub.isClosed (h : Hub α) : IO Bool :=
 /-- Get the current number of subscribers. -/
 def Hub.subscriberCount (h : Hub α) : IO Nat := do
   let st ← h.state.get
-  return st.subscribers.size
+  return st.blocking.size + st.lossy.size
 
 end Broadcast
 end Conduit
@@ -17,14 +17,76 @@ opaque new (α : Type) : IO (Channel α)
 
 /-- Create a buffered channel with given capacity.
     Capacity 0 is equivalent to unbuffered.
-    Send blocks only when buffer is full. -/
+    Send blocks only when buffer is full.
+    The capacity is a semantic bound, not an upfront allocation: the ring
+    grows lazily with actual depth and shrinks back after sustained low
+    occupancy, so large-capacity channels kept around for burst absorption
+    cost memory proportional to what they hold. -/
 @[extern "conduit_channel_new_buffered"]
 opaque newBuffered (α : Type) (capacity : Nat) : IO (Channel α)
 
+/-- Create a buffered channel backed by a lock-free MPMC ring.
+    Same semantics as `newBuffered`, but `trySend`/`tryRecv` never take a
+    mutex; blocking operations fall back to parking only when the ring is
+    full or empty. Scales much better under many concurrent senders and
+    receivers. Capacity 0 is equivalent to unbuffered. -/
+@[extern "conduit_channel_new_lock_free"]
+opaque newLockFree (α : Type) (capacity : Nat) : IO (Channel α)
+
+/-- Create a buffered channel specialized for exactly one producer task and
+    one consumer task (the topology `map` and pipeline stages create).
+    Uses a wait-free cached-index SPSC ring: no mutex on the hot path,
+    parking only when the ring is full or empty. Behavior is undefined if
+    multiple tasks send or multiple tasks receive concurrently.
+    Capacity 0 is equivalent to unbuffered. -/
+@[extern "conduit_channel_new_spsc"]
+opaque newSpsc (α : Type) (capacity : Nat) : IO (Channel α)
+
+/-- Create an unbounded channel: `send` never blocks while the channel is
+    open. Values queue through fixed-size segments allocated on demand and
+    recycled through a small cache, so memory tracks actual queue depth
+    instead of worst-case provisioning. `capacity` reports 0; `len` reports
+    the number of queued values. Use with care - without backpressure the
+    queue grows as fast as producers outpace consumers. -/
+@[extern "conduit_channel_new_unbounded"]
+opaque newUnbounded (α : Type) : IO (Channel α)
+
+/-- Create a prioritized channel: same semantics as `newBuffered`, plus a
+    small high-priority lane drained first by `recv`/`tryRecv` and select
+    readiness. Send control messages (flush, reconfigure, cancel) with
+    `sendPriority` and they are seen ahead of queued bulk data, without a
+    separate control channel doubling the select fan-in. Capacity is
+    clamped to at least 1. -/
+@[extern "conduit_channel_new_prioritized"]
+opaque newPrioritized (α : Type) (capacity : Nat) : IO (Channel α)
+
+/-- Channel that delivers one value after `ms` milliseconds and then closes.
+    Serviced by a shared native timer thread on the monotonic clock, so
+    thousands of concurrent timeouts cost one sleeping thread instead of a
+    dedicated task each. Composes with select via `Select.onRecv`. -/
+@[extern "conduit_channel_after"]
+opaque after (ms : @& Nat) : IO (Channel Unit)
+
+/-- Channel that delivers a value every `ms` milliseconds (clamped to at
+    least 1). A tick that finds the previous one still unconsumed is dropped
+    (and counted in `dropped`), so a slow receiver sees the latest tick
+    rather than a growing backlog. Close the channel to stop the ticker and
+    release its timer. -/
+@[extern "conduit_channel_ticker"]
+opaque ticker (ms : @& Nat) : IO (Channel Unit)
+
 /-- Blocking send. Returns true if sent, false if channel is closed. -/
 @[extern "conduit_channel_send"]
 opaque send (ch : @& Channel α) (value : α) : IO Bool
 
+/-- Blocking send into the priority lane of a `newPrioritized` channel:
+    the value is received ahead of anything in the main buffer, FIFO among
+    priority values. The lane is small (64 slots) and blocks when full. On
+    an ordinary channel this is a plain `send`. Returns false if the
+    channel is closed. -/
+@[extern "conduit_channel_send_priority"]
+opaque sendPriority (ch : @& Channel α) (value : α) : IO Bool
+
 /-- Blocking receive. Returns none if channel is closed and empty. -/
 @[extern "conduit_channel_recv"]
 opaque recv (ch : @& Channel α) : IO (Option α)
@@ -71,6 +133,51 @@ def sendTimeout (ch : Channel α) (value : α) (timeoutMs : Nat) : IO (Option Bo
 @[extern "conduit_channel_recv_timeout"]
 opaque recvTimeout (ch : @& Channel α) (timeoutMs : @& Nat) : IO (Option (Option α))
 
+/-- Batched non-blocking send. Moves as many values as fit into the buffer
+    under a single lock acquisition, signaling receivers once.
+    Returns the number of values accepted; callers should fall back to `send`
+    for the remainder. Always returns 0 on unbuffered or closed channels. -/
+@[extern "conduit_channel_send_all"]
+opaque sendAll (ch : @& Channel α) (values : @& Array α) : IO Nat
+
+/-- Batched non-blocking receive. Drains up to `max` values from the buffer
+    under a single lock acquisition, signaling senders once.
+    Returns an empty array if no values are immediately available. -/
+@[extern "conduit_channel_recv_up_to"]
+opaque recvUpTo (ch : @& Channel α) (max : @& Nat) : IO (Array α)
+
+/-- Batched blocking receive. Blocks until at least one value is available,
+    then drains up to `max` values under the single lock acquisition the
+    wakeup already paid for. Returns an empty array only when the channel is
+    closed and drained (mirroring `recv` returning none). -/
+@[extern "conduit_channel_recv_many"]
+opaque recvMany (ch : @& Channel α) (max : @& Nat) : IO (Array α)
+
+/-- Collect all remaining values from a channel into an array.
+    Blocks until the channel is closed. Each wakeup bulk-copies whatever is
+    buffered instead of paying a lock round trip per element. -/
+@[extern "conduit_channel_drain"]
+opaque drain (ch : @& Channel α) : IO (Array α)
+
+/-- Receive one value from whichever channel in `channels` is ready, blocking
+    until a value arrives or every input is closed and drained. The internal
+    poll rotates starting at `start % channels.size`, so a busy early channel
+    cannot starve later ones. Returns `some (i, v)` for a value `v` taken from
+    `channels[i]!`, or none once all inputs are exhausted. -/
+@[extern "conduit_channel_recv_any"]
+opaque recvAny (channels : @& Array (Channel α)) (start : @& Nat) : IO (Option (Nat × α))
+
+/-- Overwrite-on-full send: never blocks. When the buffer is full the oldest
+    value is evicted to make room, so the newest data always wins; on a
+    capacity-1 channel this conflates to a latest-value slot. Evicted values
+    are counted in `dropped`. Returns false only if the channel is closed. -/
+@[extern "conduit_channel_send_overwrite"]
+opaque sendOverwrite (ch : @& Channel α) (value : α) : IO Bool
+
+/-- Number of values evicted or discarded by `sendOverwrite`. -/
+@[extern "conduit_channel_dropped"]
+opaque dropped (ch : @& Channel α) : IO Nat
+
 /-- Close the channel.
     After closing:
     - All pending and future sends return false
@@ -79,20 +186,95 @@ opaque recvTimeout (ch : @& Channel α) (timeoutMs : @& Nat) : IO (Option (Optio
 @[extern "conduit_channel_close"]
 opaque close (ch : @& Channel α) : IO Unit
 
-/-- Check if the channel is closed (non-blocking). -/
+/-- Check if the channel is closed (non-blocking). A single atomic load:
+    safe to call from a monitoring loop without contending with the
+    channel's own traffic. -/
 @[extern "conduit_channel_is_closed"]
 opaque isClosed (ch : @& Channel α) : IO Bool
 
-/-- Get current number of items in buffer (0 for unbuffered channels). -/
+/-- Get current number of items in buffer (0 for unbuffered channels).
+    Reads a lock-free mirror of the count, so sampling many channels never
+    contends with them; the value is approximate under concurrent
+    sends and receives. -/
 @[extern "conduit_channel_len"]
 opaque len (ch : @& Channel α) : IO Nat
 
+/-- Register an edge-triggered high-water callback: `handler` runs (on the
+    sending thread) once when the buffer depth reaches `threshold`, and
+    again only after depth has dropped back under the threshold. Turns
+    backpressure discovery from polling `len` into notification. The
+    handler must not block; registering replaces any previous handler. -/
+@[extern "conduit_channel_on_high_water"]
+opaque onHighWater (ch : @& Channel α) (threshold : @& Nat) (handler : IO Unit) : IO Unit
+
 /-- Get buffer capacity (0 for unbuffered channels). -/
 @[extern "conduit_channel_capacity"]
 opaque capacity (ch : @& Channel α) : IO Nat
 
+@[extern "conduit_channel_set_wait_mode"]
+private opaque setWaitModeRaw (ch : @& Channel α) (mode : UInt8) : IO Unit
+
+/-- Set how blocked unbuffered handoffs in `send`/`recv` wait. The default
+    `.park` sleeps on a condvar immediately, which costs a few microseconds
+    per rendezvous. `.hybrid` spins briefly with a pause hint before
+    parking, and `.spin` spins until the peer arrives, giving
+    sub-microsecond handoffs between threads that are both running - at
+    the price of burning a core while waiting. Reserve `.hybrid`/`.spin`
+    for pinned, latency-critical request/reply paths. -/
+def setWaitMode (ch : Channel α) (mode : WaitMode) : IO Unit :=
+  setWaitModeRaw ch (match mode with
+    | .park => 0
+    | .hybrid => 1
+    | .spin => 2)
+
+/-- Hot-path statistics for a channel. All counters are zero until
+    `enableStats` is called on the channel. -/
+structure Stats where
+  /-- Values successfully sent -/
+  sends : Nat
+  /-- Values successfully received -/
+  recvs : Nat
+  /-- Send operations that had to block -/
+  sendBlocks : Nat
+  /-- Receive operations that had to block -/
+  recvBlocks : Nat
+  /-- Cumulative nanoseconds spent blocked -/
+  blockedNanos : Nat
+  /-- Maximum observed buffer depth -/
+  highWater : Nat
+  deriving Repr, BEq, Inhabited
+
+/-- Enable statistics collection for this channel (idempotent).
+    Counters are maintained with relaxed atomics, so the hot path pays
+    only a few uncontended increments. -/
+@[extern "conduit_channel_enable_stats"]
+opaque enableStats (ch : @& Channel α) : IO Unit
+
+/-- Read accumulated statistics. All zeros unless `enableStats` was called. -/
+@[extern "conduit_channel_stats"]
+opaque stats (ch : @& Channel α) : IO Stats
+
 end Conduit.Channel
 
+namespace Conduit
+
+/-- Wake every thread blocked in a channel operation so it can re-check its
+    task's cancellation flag. Blocked operations sleep until an actual
+    channel event, so after `IO.cancel` alone a blocked task would only
+    observe cancellation on the next send/recv/close. Prefer `Conduit.cancel`,
+    which combines both steps. -/
+@[extern "conduit_wake_blocked"]
+opaque wakeBlocked : IO Unit
+
+/-- Cancel a task and wake any channel operation it is blocked in.
+    A canceled operation completes as if the channel were closed:
+    `send` returns false and `recv` returns none. -/
+def cancel {α : Type} (t : Task α) : IO Unit := do
+  IO.cancel t
+  wakeBlocked
+
+end Conduit
+
 namespace Conduit.Channel.Debug
 
 /-- Get allocation statistics for testing finalizers.
@@ -106,4 +288,10 @@ opaque getAllocStats : IO (Nat × Nat)
 @[extern "conduit_reset_alloc_stats"]
 opaque resetAllocStats : IO Unit
 
+/-- Get channel pool statistics.
+    Returns (pool_hits, cold_allocs): how many channel creations were served
+    from the recycling pool versus a cold allocation. -/
+@[extern "conduit_get_pool_stats"]
+opaque getPoolStats : IO (Nat × Nat)
+
 end Conduit.Channel.Debug
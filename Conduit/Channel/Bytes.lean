@@ -0,0 +1,78 @@
+/-
+  Conduit.Channel.Bytes
+
+  Byte-stream channel for bulk binary data.
+
+  A regular `Channel ByteArray` moves one boxed object per chunk, which
+  forces the producer to guess chunk sizes and pays allocator churn per
+  packet. `Channel.Bytes` is backed by a contiguous byte ring on the C
+  side: writes memcpy directly into the ring under one lock and reads
+  drain into a single allocation, so throughput is memcpy-bounded and
+  backpressure is expressed in bytes rather than message counts.
+
+  Reads and writes follow `read(2)`/`write(2)` semantics: they block until
+  at least one byte (of data / of space) is available, then transfer as
+  much as fits in one go. Byte channels do not participate in select.
+-/
+
+import Conduit.Core
+
+namespace Conduit
+
+/-- Opaque handle for the byte-stream channel. -/
+opaque BytesChannelPointed : NonemptyType
+
+/-- A channel streaming raw bytes through a contiguous ring buffer. -/
+def Channel.Bytes : Type := BytesChannelPointed.type
+
+instance : Nonempty Channel.Bytes := BytesChannelPointed.property
+
+namespace Channel.Bytes
+
+/-- Create a byte-stream channel. Capacity is in bytes (clamped to ≥ 1). -/
+@[extern "conduit_bytes_channel_new"]
+opaque new (capacity : Nat) : IO Channel.Bytes
+
+/-- Write bytes into the ring. Blocks until at least one byte of space is
+    free (or the channel closes), then copies as much of `data` as fits
+    under one lock. Returns the number of bytes written; 0 means the
+    channel is closed (or `data` was empty). -/
+@[extern "conduit_bytes_channel_write"]
+opaque writeBytes (ch : @& Channel.Bytes) (data : @& ByteArray) : IO Nat
+
+/-- Read up to `max` bytes from the ring. Blocks until at least one byte
+    is available (or the channel is closed and drained), then copies into
+    a single fresh `ByteArray`. An empty result means closed-and-drained. -/
+@[extern "conduit_bytes_channel_read"]
+opaque readBytes (ch : @& Channel.Bytes) (max : @& Nat) : IO ByteArray
+
+/-- Write all of `data` starting at `offset`, blocking as needed.
+    Returns false if the channel closed before everything was written. -/
+partial def writeAll (ch : Channel.Bytes) (data : ByteArray) (offset : Nat := 0) : IO Bool := do
+  if offset >= data.size then
+    return true
+  let written ← ch.writeBytes (data.extract offset data.size)
+  if written == 0 then
+    return false
+  writeAll ch data (offset + written)
+
+/-- Close the channel. Pending reads drain remaining bytes, then return
+    empty arrays. Closing is idempotent. -/
+@[extern "conduit_bytes_channel_close"]
+opaque close (ch : @& Channel.Bytes) : IO Unit
+
+/-- Check if the channel is closed (non-blocking). -/
+@[extern "conduit_bytes_channel_is_closed"]
+opaque isClosed (ch : @& Channel.Bytes) : IO Bool
+
+/-- Number of bytes currently buffered. -/
+@[extern "conduit_bytes_channel_len"]
+opaque len (ch : @& Channel.Bytes) : IO Nat
+
+/-- Ring capacity in bytes. -/
+@[extern "conduit_bytes_channel_capacity"]
+opaque capacity (ch : @& Channel.Bytes) : IO Nat
+
+end Channel.Bytes
+
+end Conduit
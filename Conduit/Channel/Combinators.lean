@@ -23,16 +23,25 @@ def recv! (ch : Channel α) : IO α := do
   | some v => pure v
   | none => throw (IO.userError "receive on closed channel")
 
+/-- Chunk size for batched receive loops. -/
+private def recvChunkSize : Nat := 64
+
 /-- Iterate over all values from a channel until it is closed.
-    The function f is called for each received value. -/
+    The function f is called for each received value.
+    Values are pulled in chunks via `recvMany`, so consumers pay one lock
+    acquisition per wakeup instead of one per element. -/
 partial def forEach (ch : Channel α) (f : α → IO Unit) : IO Unit := do
-  match ← ch.recv with
-  | some v =>
-    f v
+  let chunk ← ch.recvMany recvChunkSize
+  if chunk.isEmpty then
+    pure ()
+  else do
+    for v in chunk do
+      f v
     forEach ch f
-  | none => pure ()
 
-/-- Helper for ForIn instance - loops until channel closed or early exit. -/
+/-- Helper for ForIn instance - loops until channel closed or early exit.
+    Receives one value at a time: pulling chunks here would silently discard
+    already-dequeued values when the body exits early with `break`. -/
 private partial def forInLoop {α β : Type} (ch : Channel α)
     (f : α → β → IO (ForInStep β)) (acc : β) : IO β := do
   match ← ch.recv with
@@ -47,32 +56,18 @@ private partial def forInLoop {α β : Type} (ch : Channel α)
 instance : ForIn IO (Channel α) α where
   forIn ch init f := forInLoop ch f init
 
-/-- Collect all remaining values from a channel into an array.
-    Blocks until the channel is closed. -/
-partial def drain (ch : Channel α) : IO (Array α) := do
-  let rec loop (acc : Array α) : IO (Array α) := do
-    match ← ch.recv with
-    | some v => loop (acc.push v)
-    | none => pure acc
-  loop #[]
-
-/-- Create a buffered channel pre-filled with values from an array.
-    The channel is closed after all values are added. -/
-def fromArray (arr : Array α) : IO (Channel α) := do
-  let ch ← Channel.newBuffered α arr.size
-  for v in arr do
-    let _ ← ch.send v
-  ch.close
-  pure ch
+/-- Create a buffered channel pre-filled with the array's values and
+    already closed. Built natively in one step: the ring is allocated at
+    `arr.size` and the values are moved straight in, with none of the
+    per-element locking and signaling that sending into a channel nobody
+    is reading yet would pay. -/
+@[extern "conduit_channel_from_array"]
+opaque fromArray (arr : @& Array α) : IO (Channel α)
 
 /-- Create a buffered channel pre-filled with values from a list.
     The channel is closed after all values are added. -/
-def fromList (lst : List α) : IO (Channel α) := do
-  let ch ← Channel.newBuffered α lst.length
-  for v in lst do
-    let _ ← ch.send v
-  ch.close
-  pure ch
+def fromList (lst : List α) : IO (Channel α) :=
+  fromArray lst.toArray
 
 /-- Default buffer size for combinator output channels. -/
 private def defaultBufferSize : Nat := 16
@@ -100,25 +95,102 @@ def filter (ch : Channel α) (p : α → Bool) (bufferSize : Nat := defaultBuffe
     out.close
   pure out
 
+/-- Map a function over channel values with a pool of `workers` dedicated
+    threads pulling from the input - for CPU-heavy stages that the single
+    thread `map` spawns would bottleneck. With `ordered := false` results
+    are emitted as workers finish; with `ordered := true` inputs are
+    stamped with sequence numbers and a reorder buffer on the output
+    restores the input order (at the cost of one extra hop and buffering
+    up to one in-flight result per worker).
+    The output channel is closed when the input is exhausted and all
+    workers have finished. -/
+def parMap (ch : Channel α) (f : α → β) (workers : Nat := 4)
+    (ordered : Bool := false) (bufferSize : Nat := defaultBufferSize)
+    : IO (Channel β) := do
+  let workers := max workers 1
+  let out ← Channel.newBuffered β bufferSize
+
+  if !ordered then
+    let remaining ← IO.mkRef workers
+    for _ in [:workers] do
+      let _ ← IO.asTask (prio := .dedicated) do
+        ch.forEach fun v => do
+          let _ ← out.send (f v)
+        let count ← remaining.modifyGet fun n => (n - 1, n - 1)
+        if count == 0 then
+          out.close
+    return out
+
+  -- Ordered mode: a stamper tags inputs with sequence numbers, workers tag
+  -- their results, and a reorderer emits them in input order.
+  let stamped ← Channel.newBuffered (Nat × α) bufferSize
+  let results ← Channel.newBuffered (Nat × β) bufferSize
+
+  let _ ← IO.asTask (prio := .dedicated) do
+    let seqRef ← IO.mkRef 0
+    ch.forEach fun v => do
+      let seq ← seqRef.modifyGet fun n => (n, n + 1)
+      let _ ← stamped.send (seq, v)
+    stamped.close
+
+  let remaining ← IO.mkRef workers
+  for _ in [:workers] do
+    let _ ← IO.asTask (prio := .dedicated) do
+      stamped.forEach fun (seq, v) => do
+        let _ ← results.send (seq, f v)
+      let count ← remaining.modifyGet fun n => (n - 1, n - 1)
+      if count == 0 then
+        results.close
+
+  let _ ← IO.asTask (prio := .dedicated) do
+    let nextRef ← IO.mkRef 0
+    let pendingRef ← IO.mkRef (#[] : Array (Nat × β))
+    results.forEach fun (seq, v) => do
+      let next ← nextRef.get
+      if seq == next then
+        let _ ← out.send v
+        -- Flush buffered successors now unblocked
+        let mut n := next + 1
+        let mut buf ← pendingRef.get
+        let mut flushing := true
+        while flushing do
+          match buf.find? (·.1 == n) with
+          | some (_, w) =>
+            let _ ← out.send w
+            buf := buf.filter (·.1 != n)
+            n := n + 1
+          | none => flushing := false
+        nextRef.set n
+        pendingRef.set buf
+      else
+        pendingRef.modify (·.push (seq, v))
+    out.close
+
+  pure out
+
 /-- Merge multiple channels into one.
     Values are received from all channels and sent to the output.
-    Spawns a task for each input channel.
+    A single task services every input through `recvAny`, registering as a
+    select waiter on all of them instead of dedicating a thread per input.
+    Each input keeps its FIFO order in the output; the rotating poll keeps
+    one busy input from starving the rest.
     The output channel is closed when all input channels are exhausted. -/
 def merge (channels : Array (Channel α)) (bufferSize : Nat := defaultBufferSize) : IO (Channel α) := do
   let out ← Channel.newBuffered α bufferSize
-  let remaining ← IO.mkRef channels.size
 
   if channels.isEmpty then
     out.close
     return out
 
-  for ch in channels do
-    let _ ← IO.asTask (prio := .dedicated) do
-      ch.forEach fun v => do
+  let _ ← IO.asTask (prio := .dedicated) do
+    let mut start := 0
+    repeat
+      match ← recvAny channels start with
+      | some (idx, v) =>
         let _ ← out.send v
-      let count ← remaining.modifyGet fun n => (n - 1, n - 1)
-      if count == 0 then
-        out.close
+        start := idx + 1
+      | none => break
+    out.close
 
   pure out
 
@@ -0,0 +1,59 @@
+/-
+  Conduit.Channel.Pipeline
+
+  Fused processing pipelines: map/filter stages accumulated as one composed
+  function and run in a single task. A chain like `ch |>> parse |>? valid`
+  materializes an intermediate channel and a dedicated thread per stage,
+  so every message pays one mutex handoff per stage; a fused pipeline pays
+  one handoff total, however many stages it has.
+-/
+
+import Conduit.Core
+import Conduit.Channel
+import Conduit.Channel.Combinators
+
+namespace Conduit
+
+variable {α β γ : Type}
+
+/-- A fused pipeline from `α` to `β`: stages are composed into a single
+    function, with `none` marking values dropped by a filter stage.
+    Build with `Pipeline.start`, chain `map`/`filter`, then attach it to a
+    channel with `run`. -/
+structure Pipeline (α β : Type) where
+  private mk ::
+  private apply : α → Option β
+
+namespace Pipeline
+
+/-- The empty pipeline; the starting point for a chain of stages. -/
+def start (α : Type) : Pipeline α α := ⟨fun a => some a⟩
+
+/-- Append a map stage. Pure function composition - no intermediate
+    channel, no extra thread. -/
+def map (p : Pipeline α β) (f : β → γ) : Pipeline α γ :=
+  ⟨fun a => (p.apply a).map f⟩
+
+/-- Append a filter stage. Values failing the predicate are dropped. -/
+def filter (p : Pipeline α β) (pred : β → Bool) : Pipeline α β :=
+  ⟨fun a =>
+    match p.apply a with
+    | some b => if pred b then some b else none
+    | none => none⟩
+
+/-- Run the pipeline: a single task reads the input channel, applies every
+    stage in one pass, and sends surviving values to one output channel.
+    The output channel is closed when the input is exhausted. -/
+def run (p : Pipeline α β) (ch : Channel α) (bufferSize : Nat := 16)
+    : IO (Channel β) := do
+  let out ← Channel.newBuffered β bufferSize
+  let _ ← IO.asTask (prio := .dedicated) do
+    Channel.forEach ch fun v => do
+      match p.apply v with
+      | some w => let _ ← out.send w
+      | none => pure ()
+    out.close
+  pure out
+
+end Pipeline
+end Conduit
@@ -0,0 +1,132 @@
+/-
+  Conduit.Channel.Scalar
+
+  Specialized channels for unboxed scalar payloads.
+
+  A regular `Channel UInt64` boxes every value into a `lean_object *`
+  before it enters the ring. The types here carry a flat `uint64_t`/
+  `double` ring on the C side instead, eliminating the allocation per
+  message and making the buffer cache-friendly - worthwhile for metrics
+  pipelines moving raw counters and timestamps.
+
+  Scalar channels are always buffered (capacity is clamped to at least 1)
+  and do not participate in select.
+-/
+
+import Conduit.Core
+
+namespace Conduit
+
+/-- Opaque handle for the unboxed UInt64 channel. -/
+opaque UInt64ChannelPointed : NonemptyType
+
+/-- A channel carrying unboxed 64-bit integers through a flat ring. -/
+def Channel.UInt64 : Type := UInt64ChannelPointed.type
+
+instance : Nonempty Channel.UInt64 := UInt64ChannelPointed.property
+
+/-- Opaque handle for the unboxed Float channel. -/
+opaque FloatChannelPointed : NonemptyType
+
+/-- A channel carrying unboxed 64-bit floats through a flat ring. -/
+def Channel.Float : Type := FloatChannelPointed.type
+
+instance : Nonempty Channel.Float := FloatChannelPointed.property
+
+namespace Channel.UInt64
+
+/-- Create a UInt64 channel with the given capacity (clamped to ≥ 1). -/
+@[extern "conduit_u64_channel_new"]
+opaque new (capacity : Nat) : IO Channel.UInt64
+
+/-- Blocking send. Returns true if sent, false if channel is closed. -/
+@[extern "conduit_u64_channel_send"]
+opaque send (ch : @& Channel.UInt64) (value : _root_.UInt64) : IO Bool
+
+/-- Blocking receive. Returns none if channel is closed and empty. -/
+@[extern "conduit_u64_channel_recv"]
+opaque recv (ch : @& Channel.UInt64) : IO (Option _root_.UInt64)
+
+/-- Non-blocking send attempt.
+    Returns 0 = success, 1 = would block, 2 = closed. -/
+@[extern "conduit_u64_channel_try_send"]
+private opaque trySendRaw (ch : @& Channel.UInt64) (value : _root_.UInt64) : IO UInt8
+
+/-- Non-blocking send. -/
+def trySend (ch : Channel.UInt64) (value : _root_.UInt64) : IO TrySendResult := do
+  match ← trySendRaw ch value with
+  | 0 => pure .ok
+  | 1 => pure .full
+  | _ => pure .closed
+
+/-- Non-blocking receive. -/
+@[extern "conduit_u64_channel_try_recv"]
+opaque tryRecv (ch : @& Channel.UInt64) : IO (TryResult _root_.UInt64)
+
+/-- Close the channel. Receives drain remaining values, then return none. -/
+@[extern "conduit_scalar_channel_close"]
+opaque close (ch : @& Channel.UInt64) : IO Unit
+
+/-- Check if the channel is closed (non-blocking). -/
+@[extern "conduit_scalar_channel_is_closed"]
+opaque isClosed (ch : @& Channel.UInt64) : IO Bool
+
+/-- Get current number of items in the buffer. -/
+@[extern "conduit_scalar_channel_len"]
+opaque len (ch : @& Channel.UInt64) : IO Nat
+
+/-- Get buffer capacity. -/
+@[extern "conduit_scalar_channel_capacity"]
+opaque capacity (ch : @& Channel.UInt64) : IO Nat
+
+end Channel.UInt64
+
+namespace Channel.Float
+
+/-- Create a Float channel with the given capacity (clamped to ≥ 1). -/
+@[extern "conduit_f64_channel_new"]
+opaque new (capacity : Nat) : IO Channel.Float
+
+/-- Blocking send. Returns true if sent, false if channel is closed. -/
+@[extern "conduit_f64_channel_send"]
+opaque send (ch : @& Channel.Float) (value : _root_.Float) : IO Bool
+
+/-- Blocking receive. Returns none if channel is closed and empty. -/
+@[extern "conduit_f64_channel_recv"]
+opaque recv (ch : @& Channel.Float) : IO (Option _root_.Float)
+
+/-- Non-blocking send attempt.
+    Returns 0 = success, 1 = would block, 2 = closed. -/
+@[extern "conduit_f64_channel_try_send"]
+private opaque trySendRaw (ch : @& Channel.Float) (value : _root_.Float) : IO UInt8
+
+/-- Non-blocking send. -/
+def trySend (ch : Channel.Float) (value : _root_.Float) : IO TrySendResult := do
+  match ← trySendRaw ch value with
+  | 0 => pure .ok
+  | 1 => pure .full
+  | _ => pure .closed
+
+/-- Non-blocking receive. -/
+@[extern "conduit_f64_channel_try_recv"]
+opaque tryRecv (ch : @& Channel.Float) : IO (TryResult _root_.Float)
+
+/-- Close the channel. Receives drain remaining values, then return none. -/
+@[extern "conduit_scalar_channel_close"]
+opaque close (ch : @& Channel.Float) : IO Unit
+
+/-- Check if the channel is closed (non-blocking). -/
+@[extern "conduit_scalar_channel_is_closed"]
+opaque isClosed (ch : @& Channel.Float) : IO Bool
+
+/-- Get current number of items in the buffer. -/
+@[extern "conduit_scalar_channel_len"]
+opaque len (ch : @& Channel.Float) : IO Nat
+
+/-- Get buffer capacity. -/
+@[extern "conduit_scalar_channel_capacity"]
+opaque capacity (ch : @& Channel.Float) : IO Nat
+
+end Channel.Float
+
+end Conduit
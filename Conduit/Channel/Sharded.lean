@@ -0,0 +1,124 @@
+/-
+  Conduit.Channel.Sharded
+
+  Sharded channel for many-core MPMC scaling. Past a handful of producers,
+  throughput through a single channel degrades below its single-threaded
+  rate: every sender and receiver serializes on one cache line. A sharded
+  channel spreads traffic over n independent lock-free sub-rings, each
+  with its own signaling, so cores contend only 1/n of the time.
+
+  The trade is ordering: values are FIFO within a shard, but there is no
+  global order across shards. The distinct `Sharded` type makes that
+  relaxation explicit - code that needs total FIFO ordering keeps using
+  `Channel`.
+-/
+
+import Conduit.Core
+import Conduit.Channel
+
+namespace Conduit
+
+variable {α : Type}
+
+/-- A channel sharded over independent lock-free sub-rings. Per-shard FIFO
+    only; no ordering across shards. Build with `Sharded.new`. -/
+structure Sharded (α : Type) where
+  private mk ::
+  private shards : Array (Channel α)
+  /-- Round-robin send cursor. Races on the cursor only skew load
+      balancing, never correctness, so a plain ref suffices. -/
+  private sendCursor : IO.Ref Nat
+  private recvCursor : IO.Ref Nat
+
+namespace Sharded
+
+/-- Create a sharded channel. `capacity` is the total buffer budget,
+    split evenly across `shards` sub-rings (at least 1 slot each).
+    More shards than concurrent senders just wastes sweep time; the
+    default suits up to ~8 producers per shard. -/
+def new (α : Type) (capacity : Nat) (shards : Nat := 8) : IO (Sharded α) := do
+  let n := max shards 1
+  let perShard := max ((capacity + n - 1) / n) 1
+  let mut arr : Array (Channel α) := #[]
+  for _ in [:n] do
+    arr := arr.push (← Channel.newLockFree α perShard)
+  return ⟨arr, ← IO.mkRef 0, ← IO.mkRef 0⟩
+
+/-- Number of sub-rings. -/
+def shardCount (s : Sharded α) : Nat :=
+  s.shards.size
+
+/-- Blocking send. Sweeps the shards round-robin for free space without
+    blocking; only when every shard is full does it block, on the shard
+    the cursor selected. Returns false if the channel is closed. -/
+def send (s : Sharded α) (value : α) : IO Bool := do
+  let n := s.shards.size
+  let start ← s.sendCursor.modifyGet fun c => (c, c + 1)
+  for k in [:n] do
+    let r ← s.shards[(start + k) % n]!.trySend value
+    if r.isOk then
+      return true
+  s.shards[start % n]!.send value
+
+/-- Non-blocking send. Sweeps every shard once; reports `full` only when
+    all shards are full. -/
+def trySend (s : Sharded α) (value : α) : IO TrySendResult := do
+  let n := s.shards.size
+  let start ← s.sendCursor.modifyGet fun c => (c, c + 1)
+  let mut sawFull := false
+  for k in [:n] do
+    match ← s.shards[(start + k) % n]!.trySend value with
+    | .ok => return .ok
+    | .full => sawFull := true
+    | .closed => pure ()
+  return if sawFull then .full else .closed
+
+/-- Blocking receive. Sweeps the shards from a rotating start (so a busy
+    shard cannot starve the others) and parks on all of them when every
+    shard is empty. Returns none once all shards are closed and drained. -/
+def recv (s : Sharded α) : IO (Option α) := do
+  let start ← s.recvCursor.get
+  match ← Channel.recvAny s.shards start with
+  | some (idx, v) =>
+    s.recvCursor.set (idx + 1)
+    return some v
+  | none => return none
+
+/-- Non-blocking receive, sweeping every shard once. -/
+def tryRecv (s : Sharded α) : IO (TryResult α) := do
+  let n := s.shards.size
+  let start ← s.recvCursor.get
+  let mut sawEmpty := false
+  for k in [:n] do
+    let i := (start + k) % n
+    match ← s.shards[i]!.tryRecv with
+    | .ok v =>
+      s.recvCursor.set (i + 1)
+      return .ok v
+    | .empty => sawEmpty := true
+    | .closed => pure ()
+  return if sawEmpty then .empty else .closed
+
+/-- Close every shard. Like `Channel.close`: senders fail immediately,
+    receivers drain what remains. Idempotent. -/
+def close (s : Sharded α) : IO Unit := do
+  for ch in s.shards do
+    ch.close
+
+/-- True once every shard is closed. -/
+def isClosed (s : Sharded α) : IO Bool := do
+  for ch in s.shards do
+    unless ← ch.isClosed do
+      return false
+  return true
+
+/-- Total queued values across all shards (approximate under concurrent
+    traffic, like `Channel.len`). -/
+def len (s : Sharded α) : IO Nat := do
+  let mut total := 0
+  for ch in s.shards do
+    total := total + (← ch.len)
+  return total
+
+end Sharded
+end Conduit
@@ -0,0 +1,79 @@
+/-
+  Conduit.Channel.Shm
+
+  Shared-memory channel for cross-process transport.
+
+  Bridging two processes with a socket costs two copies and a syscall per
+  message. `Channel.Shm` instead puts the ring itself - and
+  process-shared pthread mutex/condvars beside it - in an `mmap`ed file,
+  so a send from one process to another is a plain shared-memory enqueue
+  with no syscall on the hot path.
+
+  Payloads are fixed-size byte records agreed at `create` time: the
+  caller owns encoding, and nothing containing pointers or Lean objects
+  may cross the process boundary. One process calls `create`; peers call
+  `attach` on the same path. The primitives are not crash-robust: if a
+  peer dies while holding the lock, recreate the segment. Shm channels do
+  not participate in select.
+-/
+
+import Conduit.Core
+
+namespace Conduit
+
+/-- Opaque handle for the shared-memory channel. -/
+opaque ShmChannelPointed : NonemptyType
+
+/-- A cross-process channel of fixed-size byte records backed by an
+    `mmap`ed file segment. -/
+def Channel.Shm : Type := ShmChannelPointed.type
+
+instance : Nonempty Channel.Shm := ShmChannelPointed.property
+
+namespace Channel.Shm
+
+/-- Create (or overwrite) the segment file at `path` and initialize a ring
+    of `capacity` records of `elemSize` bytes each (both clamped to ≥ 1).
+    The file remains until deleted; peers `attach` to it by path. -/
+@[extern "conduit_shm_channel_create"]
+opaque create (path : @& String) (capacity : @& Nat) (elemSize : @& Nat) : IO Channel.Shm
+
+/-- Map an existing segment created by another process (or this one).
+    Fails if the file is missing or was not produced by `create`. -/
+@[extern "conduit_shm_channel_attach"]
+opaque attach (path : @& String) : IO Channel.Shm
+
+/-- Copy one record into the ring, blocking while it is full. `data` must
+    be exactly `elemSize` bytes. Returns false if the segment is closed. -/
+@[extern "conduit_shm_channel_send"]
+opaque send (ch : @& Channel.Shm) (data : @& ByteArray) : IO Bool
+
+/-- Copy one record out of the ring, blocking while it is empty.
+    Returns none once the segment is closed and drained. -/
+@[extern "conduit_shm_channel_recv"]
+opaque recv (ch : @& Channel.Shm) : IO (Option ByteArray)
+
+/-- Close the segment for every attached process. Pending receives drain
+    remaining records, then return none. Closing is idempotent. -/
+@[extern "conduit_shm_channel_close"]
+opaque close (ch : @& Channel.Shm) : IO Unit
+
+/-- Check if the segment is closed (non-blocking). -/
+@[extern "conduit_shm_channel_is_closed"]
+opaque isClosed (ch : @& Channel.Shm) : IO Bool
+
+/-- Number of records currently queued. -/
+@[extern "conduit_shm_channel_len"]
+opaque len (ch : @& Channel.Shm) : IO Nat
+
+/-- Ring capacity in records. -/
+@[extern "conduit_shm_channel_capacity"]
+opaque capacity (ch : @& Channel.Shm) : IO Nat
+
+/-- Bytes per record, as fixed at `create` time. -/
+@[extern "conduit_shm_channel_elem_size"]
+opaque elemSize (ch : @& Channel.Shm) : IO Nat
+
+end Channel.Shm
+
+end Conduit
@@ -34,6 +34,13 @@ namespace SendResult
 
 end SendResult
 
+/-- How a blocked unbuffered handoff waits (see `Channel.setWaitMode`) -/
+inductive WaitMode where
+  | park    -- Sleep on the condvar immediately (default)
+  | hybrid  -- Spin briefly, then park
+  | spin    -- Spin until ready (burns a core; for pinned threads)
+  deriving Repr, BEq, Inhabited
+
 /-- Result of a non-blocking send operation -/
 inductive TrySendResult where
   | ok       -- Successfully sent
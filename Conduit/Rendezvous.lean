@@ -0,0 +1,62 @@
+/-
+  Conduit.Rendezvous
+
+  Request/reply rendezvous between callers and a server.
+
+  Request/reply over channels pays a fresh reply channel per request - a
+  heap allocation, a mutex init, and two condvar inits for exactly one
+  handoff. A `Rendezvous α β` instead parks each caller on a one-shot
+  slot living on the caller's own stack: the server dequeues the slot,
+  runs the handler, writes the reply straight into the slot, and wakes
+  the caller with a single signal. One allocation-free round-trip per
+  call.
+
+  Callers are served in FIFO order. Multiple servers may `serve` the same
+  rendezvous concurrently; each call is handled by exactly one of them.
+-/
+
+import Conduit.Core
+
+namespace Conduit
+
+/-- Opaque handle for the rendezvous. -/
+opaque RendezvousPointed : NonemptyType
+
+/-- A request/reply rendezvous carrying requests of type `α` and replies
+    of type `β`. -/
+def Rendezvous (α β : Type) : Type := RendezvousPointed.type
+
+instance {α β : Type} : Nonempty (Rendezvous α β) := RendezvousPointed.property
+
+namespace Rendezvous
+
+/-- Create a rendezvous. -/
+@[extern "conduit_rendezvous_new"]
+opaque new (α β : Type) : IO (Rendezvous α β)
+
+/-- Send a request and block until a server replies. Returns none if the
+    rendezvous is closed (or closes while waiting), or if the handler
+    serving this call fails. -/
+@[extern "conduit_rendezvous_call"]
+opaque call {α β : Type} (r : @& Rendezvous α β) (request : α) : IO (Option β)
+
+/-- Serve calls with `handler` until the rendezvous closes or the serving
+    task is canceled. The handler runs one request at a time on this
+    task's thread; if it throws, the waiting caller receives none and the
+    error propagates out of `serve`. Run from a task spawned with
+    `IO.asTask (prio := .dedicated)` since serving blocks. -/
+@[extern "conduit_rendezvous_serve"]
+opaque serve {α β : Type} (r : @& Rendezvous α β) (handler : α → IO β) : IO Unit
+
+/-- Close the rendezvous: parked callers wake with none, future calls
+    return none immediately, and servers return once idle. Idempotent. -/
+@[extern "conduit_rendezvous_close"]
+opaque close {α β : Type} (r : @& Rendezvous α β) : IO Unit
+
+/-- Check whether the rendezvous is closed. -/
+@[extern "conduit_rendezvous_is_closed"]
+opaque isClosed {α β : Type} (r : @& Rendezvous α β) : IO Bool
+
+end Rendezvous
+
+end Conduit
@@ -15,6 +15,10 @@ namespace Conduit.Select
 @[extern "conduit_select_poll"]
 private opaque pollRaw (cases : @& Array (Channel Unit × Bool)) : IO (Option Nat)
 
+/-- Poll an array of (channel, isSend) pairs, returning every ready index. -/
+@[extern "conduit_select_poll_all"]
+private opaque pollAllRaw (cases : @& Array (Channel Unit × Bool)) : IO (Array Nat)
+
 /-- Wait for any channel to become ready.
     timeout is in milliseconds (0 = wait forever).
     Returns the index of the ready channel, or none on timeout. -/
@@ -25,20 +29,30 @@ private opaque waitRaw (cases : @& Array (Channel Unit × Bool)) (timeout : @& N
 private def toRawCases (b : Builder) : Array (Channel Unit × Bool) :=
   b.cases.map fun info => (info.channel, info.isSend)
 
-/-- Poll all cases, returning the index of the first ready one.
+/-- Poll all cases, returning the index of the first ready one in case order.
     Non-blocking: returns none immediately if no case is ready. -/
 def poll (b : Builder) : IO (Option Nat) :=
   pollRaw (toRawCases b)
 
+/-- Poll all cases in one pass, returning every currently-ready index in
+    case order (empty if none are ready). Non-blocking. A dispatcher can
+    drain every ready channel per wakeup instead of re-entering select
+    once per message. -/
+def pollAll (b : Builder) : IO (Array Nat) :=
+  pollAllRaw (toRawCases b)
+
 /-- Wait for any case to become ready.
     Blocking: waits until at least one case is ready.
-    Returns the index of the ready case. -/
+    Returns the index of the ready case. When several cases are ready at
+    once, ties are broken starting from a rotating offset, so repeated
+    waits do not starve high-index cases. -/
 def wait (b : Builder) : IO (Option Nat) :=
   waitRaw (toRawCases b) 0
 
 /-- Wait for any case to become ready, with timeout.
     timeout is in milliseconds.
-    Returns none if timeout expires before any case is ready. -/
+    Returns none if timeout expires before any case is ready.
+    Ties between ready cases rotate as in `wait`. -/
 def waitTimeout (b : Builder) (timeoutMs : Nat) : IO (Option Nat) :=
   waitRaw (toRawCases b) timeoutMs
 
@@ -48,4 +62,93 @@ def waitTimeout (b : Builder) (timeoutMs : Nat) : IO (Option Nat) :=
 def withDefault (b : Builder) : IO (Option Nat) :=
   poll b
 
+/-! ## Fixed-arity select
+
+The builder path allocates an array of boxed pairs per call and the
+native side re-derives the channel set from it. Most hot-loop selects
+are over exactly two or three statically-known channels; these entry
+points hand the channel handles straight to dedicated FFI functions and
+get back an unboxed tag, skipping the per-call allocation entirely.
+
+The tag is the 0-based index of the ready case, or `Select.noneTag`
+when no case can ever become ready (the calling task was canceled, or
+every case is a send on a closed channel). A closed channel counts as
+recv-ready, so `recv2`/`recv3` report its index rather than `noneTag`. -/
+
+/-- Tag meaning "no case can become ready" from the fixed-arity selects. -/
+def noneTag : UInt8 := 255
+
+/-- Wait to receive from either channel; returns 0 or 1 for the ready
+    case. Ties rotate as in `wait`. -/
+@[extern "conduit_select2_rr"]
+opaque recv2 {α β : Type} (ch1 : @& Channel α) (ch2 : @& Channel β) : IO UInt8
+
+/-- Wait to receive from any of three channels; returns 0, 1 or 2 for
+    the ready case. Ties rotate as in `wait`. -/
+@[extern "conduit_select3_rrr"]
+opaque recv3 {α β γ : Type} (ch1 : @& Channel α) (ch2 : @& Channel β)
+    (ch3 : @& Channel γ) : IO UInt8
+
+@[extern "conduit_select2_rs"]
+private opaque recvSendRaw {α β : Type} (recvCh : @& Channel α)
+    (sendCh : @& Channel β) : IO UInt8
+
+/-- Wait to receive from `recvCh` (tag 0) or for send readiness on
+    `sendCh` (tag 1). As with `Builder.addSend`, the value is not sent by
+    the select itself - perform the send after the tag comes back. -/
+@[inline] def recvSend {α β : Type} (recvCh : Channel α) (sendCh : Channel β)
+    (_value : β) : IO UInt8 :=
+  recvSendRaw recvCh sendCh
+
+/-- Opaque handle for a compiled select set (wraps a C-side struct). -/
+opaque PreparedPointed : NonemptyType
+
+/-- A select set compiled once for repeated waits. The sorted unique channel
+    set and the waiter's sync primitives are built at `prepare` time, so each
+    `wait` only registers on the channels, sleeps, and deregisters - no
+    allocation or primitive initialization per call. Use this for hot event
+    loops that select over the same channels thousands of times.
+
+    A prepared set holds a single waiter: do not wait on the same handle from
+    multiple threads concurrently. Create one handle per waiting thread. -/
+def Prepared : Type := PreparedPointed.type
+
+instance : Nonempty Prepared := PreparedPointed.property
+
+@[extern "conduit_select_prepare"]
+private opaque prepareRaw (cases : Array (Channel Unit × Bool)) : IO Prepared
+
+/-- Compile a select case set for repeated use with `Prepared.wait`.
+    The channels are retained for the lifetime of the handle. -/
+def prepare (b : Builder) : IO Prepared :=
+  prepareRaw (toRawCases b)
+
+namespace Prepared
+
+@[extern "conduit_select_prepared_wait"]
+private opaque waitRaw (p : @& Prepared) (timeout : @& Nat) : IO (Option Nat)
+
+/-- Poll the prepared cases, returning the index of the first ready one.
+    Non-blocking: returns none immediately if no case is ready. -/
+@[extern "conduit_select_prepared_poll"]
+opaque poll (p : @& Prepared) : IO (Option Nat)
+
+/-- Poll the prepared cases in one pass, returning every currently-ready
+    index in case order (empty if none are ready). Non-blocking. -/
+@[extern "conduit_select_prepared_poll_all"]
+opaque pollAll (p : @& Prepared) : IO (Array Nat)
+
+/-- Wait for any prepared case to become ready.
+    Returns the index of the ready case. Ready-case ties rotate as in
+    `Select.wait`. -/
+def wait (p : Prepared) : IO (Option Nat) :=
+  waitRaw p 0
+
+/-- Wait for any prepared case to become ready, with timeout in milliseconds.
+    Returns none if the timeout expires before any case is ready. -/
+def waitTimeout (p : Prepared) (timeoutMs : Nat) : IO (Option Nat) :=
+  waitRaw p timeoutMs
+
+end Prepared
+
 end Conduit.Select
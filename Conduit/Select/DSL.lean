@@ -47,6 +47,12 @@ def selectPoll (cases : SelectM Unit) : IO (Option Nat) := do
   let (builder, _) := cases.run Select.Builder.empty
   Select.poll builder
 
+/-- Build a select from cases and poll every case in one pass (non-blocking).
+    Returns all currently-ready indices in case order. -/
+def selectPollAll (cases : SelectM Unit) : IO (Array Nat) := do
+  let (builder, _) := cases.run Select.Builder.empty
+  Select.pollAll builder
+
 /-- Build a select from cases and wait (blocking).
     Returns the index of the ready case. -/
 def selectWait (cases : SelectM Unit) : IO (Option Nat) := do
@@ -59,6 +65,12 @@ def selectTimeout (cases : SelectM Unit) (timeoutMs : Nat) : IO (Option Nat) :=
   let (builder, _) := cases.run Select.Builder.empty
   Select.waitTimeout builder timeoutMs
 
+/-- Build a select from cases and compile it for repeated waits.
+    See `Select.Prepared` for the reuse contract. -/
+def selectPrepare (cases : SelectM Unit) : IO Select.Prepared := do
+  let (builder, _) := cases.run Select.Builder.empty
+  Select.prepare builder
+
 /-- Alias for selectWait -/
 abbrev select := selectWait
 
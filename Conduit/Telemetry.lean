@@ -0,0 +1,85 @@
+/-
+  Conduit.Telemetry
+
+  Opt-in operation latency histograms for the FFI layer.
+
+  Per-channel `Channel.Stats` counts operations; telemetry answers the
+  tail-latency question: how long do `send`, `recv`, and select waits
+  actually take inside the channel layer, process-wide? Latencies are
+  accumulated into log2-bucketed histograms in lock-free per-thread
+  blocks and merged when a snapshot is read.
+
+  Two gates keep production builds honest: the code exists only when the
+  library is compiled with `CONDUIT_FFI_TELEMETRY=1` (see the
+  `conduit_ffi_o` target in `lakefile.lean`), and recording additionally
+  requires the runtime toggle `setEnabled true`. Against an
+  uninstrumented build this API still links: `enabled` reports false and
+  snapshots are all zeros. Instrumented builds also carry USDT probe
+  points (`conduit:channel_send` / `channel_recv` / `channel_close`) for
+  attaching perf or bpftrace without another rebuild.
+-/
+
+import Conduit.Core
+
+namespace Conduit.Telemetry
+
+/-- Merged latency histogram for one operation. Bucket `i` counts
+    operations that took between `2^i` and `2^(i+1)` nanoseconds. -/
+structure Histogram where
+  /-- Operations recorded -/
+  count : Nat
+  /-- Cumulative nanoseconds across all recordings -/
+  totalNanos : Nat
+  /-- Slowest recorded operation, in nanoseconds -/
+  maxNanos : Nat
+  /-- 64 log2-spaced latency buckets -/
+  buckets : Array Nat
+  deriving Repr, BEq, Inhabited
+
+/-- Process-wide latency snapshot, one histogram per instrumented
+    operation. -/
+structure Telemetry where
+  send : Histogram
+  recv : Histogram
+  selectWait : Histogram
+  deriving Repr, BEq, Inhabited
+
+/-- Turn latency recording on or off for this process. A no-op unless the
+    library was built with `CONDUIT_FFI_TELEMETRY`. -/
+@[extern "conduit_telemetry_set_enabled"]
+opaque setEnabled (on : Bool) : IO Unit
+
+/-- True only in an instrumented build with recording turned on. -/
+@[extern "conduit_telemetry_enabled"]
+opaque enabled : IO Bool
+
+/-- Zero all accumulated histograms. Useful for isolating measurement
+    windows; racy against in-flight operations by design. -/
+@[extern "conduit_telemetry_reset"]
+opaque reset : IO Unit
+
+@[extern "conduit_telemetry_op_snapshot"]
+private opaque opSnapshotRaw (op : UInt8) : IO (Array Nat)
+
+private def opSnapshot (op : UInt8) : IO Histogram := do
+  let raw ← opSnapshotRaw op
+  return {
+    count := raw[0]!
+    totalNanos := raw[1]!
+    maxNanos := raw[2]!
+    buckets := raw.extract 3 raw.size
+  }
+
+/-- Read the merged histograms for all instrumented operations. -/
+def snapshot : IO Telemetry := do
+  return {
+    send := ← opSnapshot 0
+    recv := ← opSnapshot 1
+    selectWait := ← opSnapshot 2
+  }
+
+/-- Mean latency in nanoseconds, 0 when nothing was recorded. -/
+def Histogram.meanNanos (h : Histogram) : Nat :=
+  if h.count == 0 then 0 else h.totalNanos / h.count
+
+end Conduit.Telemetry
@@ -0,0 +1,155 @@
+/-
+  ConduitBench.Main
+
+  Benchmark harness for channel throughput and latency.
+
+  Emits one CSV line per measurement on stdout:
+
+      name,param,ops,elapsed_ns,ns_per_op
+
+  so results can be tracked across releases. Run with `lake exe conduit_bench`.
+-/
+
+import Conduit
+
+namespace ConduitBench
+
+open Conduit
+
+/-- Monotonic clock in nanoseconds (FFI, CLOCK_MONOTONIC). -/
+@[extern "conduit_monotonic_nanos"]
+opaque monotonicNanos : IO UInt64
+
+/-- Time an action, returning elapsed nanoseconds. -/
+def time (act : IO Unit) : IO UInt64 := do
+  let t0 ← monotonicNanos
+  act
+  let t1 ← monotonicNanos
+  pure (t1 - t0)
+
+/-- Emit one machine-readable result line. -/
+def report (name : String) (param : String) (ops : Nat) (elapsedNs : UInt64) : IO Unit := do
+  let nsPerOp := if ops == 0 then 0 else elapsedNs.toNat / ops
+  IO.println s!"{name},{param},{ops},{elapsedNs},{nsPerOp}"
+
+/-- Round-trip latency of the unbuffered synchronous handoff:
+    request/reply ping-pong between two dedicated threads. -/
+def benchUnbufferedRtt (rounds : Nat := 10000) : IO Unit := do
+  let req ← Channel.new Nat
+  let rep ← Channel.new Nat
+  let echo ← IO.asTask (prio := .dedicated) do
+    for v in req do
+      let _ ← rep.send v
+    rep.close
+  let elapsed ← time do
+    for i in [:rounds] do
+      let _ ← req.send i
+      let _ ← rep.recv
+  req.close
+  let _ ← IO.wait echo
+  report "unbuffered_rtt" "" rounds elapsed
+
+/-- Buffered throughput as a function of capacity:
+    one producer, one consumer. -/
+def benchBufferedThroughput (messages : Nat := 100000) : IO Unit := do
+  for capacity in [1, 16, 256, 4096] do
+    let ch ← Channel.newBuffered Nat capacity
+    let producer ← IO.asTask (prio := .dedicated) do
+      for i in [:messages] do
+        let _ ← ch.send i
+      ch.close
+    let elapsed ← time do
+      for _ in ch do
+        pure ()
+    let _ ← IO.wait producer
+    report "buffered_throughput" s!"capacity={capacity}" messages elapsed
+
+/-- Throughput as producer/consumer count scales, total message count
+    held constant. Exercises mutex, lock-free, and SPSC (1x1 only) modes. -/
+def benchScaling (messages : Nat := 100000) : IO Unit := do
+  for (mode, mk) in [
+      ("mutex", fun cap => Channel.newBuffered Nat cap),
+      ("lockfree", fun cap => Channel.newLockFree Nat cap)] do
+    for threads in [1, 2, 4, 8, 16, 32] do
+      let perProducer := messages / threads
+      let ch ← mk 1024
+      let producers ← (List.range threads).mapM fun _ =>
+        IO.asTask (prio := .dedicated) do
+          for i in [:perProducer] do
+            let _ ← ch.send i
+      let consumed ← IO.mkRef 0
+      let consumers ← (List.range threads).mapM fun _ =>
+        IO.asTask (prio := .dedicated) do
+          for _ in ch do
+            consumed.modify (· + 1)
+      let elapsed ← time do
+        for p in producers do
+          let _ ← IO.wait p
+        ch.close
+        for c in consumers do
+          let _ ← IO.wait c
+      report "scaling_throughput" s!"mode={mode},threads={threads}"
+        (perProducer * threads) elapsed
+
+  -- SPSC variant is only valid with one producer and one consumer
+  let ch ← Channel.newSpsc Nat 1024
+  let producer ← IO.asTask (prio := .dedicated) do
+    for i in [:messages] do
+      let _ ← ch.send i
+    ch.close
+  let elapsed ← time do
+    for _ in ch do
+      pure ()
+  let _ ← IO.wait producer
+  report "scaling_throughput" "mode=spsc,threads=1" messages elapsed
+
+/-- Wakeup latency of select: a sender feeds one of two channels, the
+    measuring thread blocks in selectWait each round. -/
+def benchSelectWakeup (rounds : Nat := 10000) : IO Unit := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let req ← Channel.new Nat
+  let sender ← IO.asTask (prio := .dedicated) do
+    for v in req do
+      let target := if v % 2 == 0 then ch1 else ch2
+      let _ ← target.send v
+  let elapsed ← time do
+    for i in [:rounds] do
+      let _ ← req.send i
+      let idx ← Conduit.select do
+        Conduit.recvCase ch1
+        Conduit.recvCase ch2
+      match idx with
+      | some 0 => let _ ← ch1.recv; pure ()
+      | some 1 => let _ ← ch2.recv; pure ()
+      | _ => pure ()
+  req.close
+  let _ ← IO.wait sender
+  report "select_wakeup" "cases=2" rounds elapsed
+
+/-- End-to-end throughput of a map/filter combinator pipeline. -/
+def benchPipeline (messages : Nat := 50000) : IO Unit := do
+  let source ← Channel.newBuffered Nat 64
+  let producer ← IO.asTask (prio := .dedicated) do
+    for i in [:messages] do
+      let _ ← source.send i
+    source.close
+  let mapped ← source.map (· + 1)
+  let filtered ← mapped.filter (· % 2 == 0)
+  let enriched ← filtered.map (· * 2)
+  let elapsed ← time do
+    for _ in enriched do
+      pure ()
+  let _ ← IO.wait producer
+  report "pipeline_throughput" "stages=3" messages elapsed
+
+end ConduitBench
+
+open ConduitBench in
+def main : IO Unit := do
+  IO.println "name,param,ops,elapsed_ns,ns_per_op"
+  benchUnbufferedRtt
+  benchBufferedThroughput
+  benchScaling
+  benchSelectWakeup
+  benchPipeline
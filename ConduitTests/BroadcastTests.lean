@@ -85,6 +85,50 @@ test "broadcast with single subscriber works" := do
   v1 ≡? "hello"
   v2 ≡? "world"
 
+testSuite "Broadcast.sendToAll"
+
+test "sendToAll delivers to every open subscriber" := do
+  let ch1 ← Channel.newBuffered Nat 4
+  let ch2 ← Channel.newBuffered Nat 4
+  let full ← Broadcast.sendToAll #[ch1, ch2] 7
+  full ≡ #[]
+  let v1 ← ch1.recv
+  let v2 ← ch2.recv
+  v1 ≡? 7
+  v2 ≡? 7
+
+test "sendToAll reports full subscribers" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 4
+  let _ ← ch1.send 0  -- fill ch1
+  let full ← Broadcast.sendToAll #[ch1, ch2] 9
+  full ≡ #[0]
+  let v2 ← ch2.recv
+  v2 ≡? 9
+
+test "sendToAll skips closed subscribers" := do
+  let ch1 ← Channel.newBuffered Nat 4
+  let ch2 ← Channel.newBuffered Nat 4
+  ch1.close
+  let full ← Broadcast.sendToAll #[ch1, ch2] 3
+  full ≡ #[]
+  let v2 ← ch2.recv
+  v2 ≡? 3
+
+test "broadcast survives a full subscriber" := do
+  let source ← Channel.newBuffered Nat 10
+  let subs ← Broadcast.create source 2 (bufferSize := 1)
+  for i in [:4] do
+    let _ ← source.send i
+  source.close
+  -- Drain both subscribers concurrently; the distributor falls back to a
+  -- blocking send whenever a ring is full.
+  let tasks ← subs.mapM fun sub => IO.asTask (prio := .dedicated) do
+    sub.drain
+  for task in tasks do
+    let arr ← IO.wait task >>= IO.ofExcept
+    arr ≡ #[0, 1, 2, 3]
+
 testSuite "Broadcast.Hub"
 
 test "hub allows dynamic subscription" := do
@@ -175,6 +219,62 @@ test "hub closes all subscribers when source closes" := do
   shouldBeNone v1
   shouldBeNone v2
 
+testSuite "Hub Overflow Policies"
+
+test "dropOldest subscriber keeps the newest values" := do
+  let source ← Channel.newBuffered Nat 10
+  let h ← Broadcast.hub source (bufferSize := 2)
+  let subOpt ← h.subscribe .dropOldest
+  let sub ← match subOpt with
+    | some ch => pure ch
+    | none => throw (IO.userError "subscribe failed")
+  for i in [:5] do
+    let _ ← source.send i
+  source.close
+  IO.sleep 100
+  let arr ← sub.drain
+  arr ≡ #[3, 4]
+  let d ← sub.dropped
+  d ≡ 3
+
+test "conflate subscriber sees only the latest value" := do
+  let source ← Channel.newBuffered Nat 10
+  let h ← Broadcast.hub source
+  let subOpt ← h.subscribe .conflate
+  let sub ← match subOpt with
+    | some ch => pure ch
+    | none => throw (IO.userError "subscribe failed")
+  for i in [:5] do
+    let _ ← source.send i
+  source.close
+  IO.sleep 100
+  let v ← sub.recv
+  v ≡? 4
+  let rest ← sub.recv
+  shouldBeNone rest
+
+test "lossy subscriber does not stall delivery to others" := do
+  let source ← Channel.newBuffered Nat 10
+  let h ← Broadcast.hub source (bufferSize := 1)
+  -- Never consumed: would wedge the hub under the block policy
+  let lossyOpt ← h.subscribe .conflate
+  let lossy ← match lossyOpt with
+    | some ch => pure ch
+    | none => throw (IO.userError "subscribe failed")
+  let fastOpt ← h.subscribe
+  let fast ← match fastOpt with
+    | some ch => pure ch
+    | none => throw (IO.userError "subscribe failed")
+  let reader ← IO.asTask (prio := .dedicated) do
+    fast.drain
+  for i in [:10] do
+    let _ ← source.send i
+  source.close
+  let arr ← IO.wait reader >>= IO.ofExcept
+  arr ≡ Array.range 10
+  let v ← lossy.recv
+  v ≡? 9
+
 testSuite "Hub.subscriberCount"
 
 test "subscriberCount starts at zero" := do
@@ -0,0 +1,92 @@
+/-
+  ConduitTests.BytesChannelTests
+
+  Tests for the byte-stream channel.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.BytesChannelTests
+
+open Crucible
+open Conduit
+
+testSuite "Bytes Channel"
+
+test "create bytes channel" := do
+  let ch ← Channel.Bytes.new 64
+  let cap ← ch.capacity
+  cap ≡ 64
+  let len ← ch.len
+  len ≡ 0
+
+test "capacity clamps to at least one byte" := do
+  let ch ← Channel.Bytes.new 0
+  let cap ← ch.capacity
+  cap ≡ 1
+
+test "write then read round-trips bytes" := do
+  let ch ← Channel.Bytes.new 64
+  let data := ByteArray.mk #[1, 2, 3, 4, 5]
+  let written ← ch.writeBytes data
+  written ≡ 5
+  let len ← ch.len
+  len ≡ 5
+  let out ← ch.readBytes 5
+  out.data ≡ #[1, 2, 3, 4, 5]
+
+test "partial write when ring nearly full" := do
+  let ch ← Channel.Bytes.new 4
+  let written ← ch.writeBytes (ByteArray.mk #[1, 2, 3, 4, 5, 6])
+  written ≡ 4
+  let out ← ch.readBytes 10
+  out.data ≡ #[1, 2, 3, 4]
+
+test "read drains up to max bytes" := do
+  let ch ← Channel.Bytes.new 16
+  let _ ← ch.writeBytes (ByteArray.mk #[10, 20, 30, 40])
+  let first ← ch.readBytes 2
+  first.data ≡ #[10, 20]
+  let rest ← ch.readBytes 10
+  rest.data ≡ #[30, 40]
+
+test "writes preserve byte order across wrap-around" := do
+  let ch ← Channel.Bytes.new 4
+  let _ ← ch.writeBytes (ByteArray.mk #[1, 2, 3])
+  let _ ← ch.readBytes 2  -- head advances, next write wraps
+  let _ ← ch.writeBytes (ByteArray.mk #[4, 5, 6])
+  let out ← ch.readBytes 10
+  out.data ≡ #[3, 4, 5, 6]
+
+test "read on closed drained channel returns empty" := do
+  let ch ← Channel.Bytes.new 8
+  let _ ← ch.writeBytes (ByteArray.mk #[7])
+  ch.close
+  let v ← ch.readBytes 8
+  v.data ≡ #[7]
+  let empty ← ch.readBytes 8
+  empty.size ≡ 0
+
+test "write on closed channel returns zero" := do
+  let ch ← Channel.Bytes.new 8
+  ch.close
+  let written ← ch.writeBytes (ByteArray.mk #[1, 2])
+  written ≡ 0
+
+test "writeAll blocks until reader makes space" := do
+  let ch ← Channel.Bytes.new 4
+  let payload := ByteArray.mk ((Array.range 16).map (·.toUInt8))
+  let writer ← IO.asTask (prio := .dedicated) do
+    ch.writeAll payload
+  let mut received := ByteArray.empty
+  while received.size < 16 do
+    let chunk ← ch.readBytes 16
+    received := received ++ chunk
+  let ok ← IO.wait writer
+  match ok with
+  | .ok true => pure ()
+  | _ => throw (IO.userError "writeAll should succeed")
+  received.data ≡ payload.data
+
+end ConduitTests.BytesChannelTests
@@ -100,6 +100,361 @@ test "tryRecv on buffered with data returns value" := do
   | .ok v => v ≡ 42
   | _ => throw (IO.userError "expected .ok 42")
 
+testSuite "Batch Operations"
 
+test "sendAll fills buffer up to capacity" := do
+  let ch ← Channel.newBuffered Nat 3
+  let accepted ← ch.sendAll #[1, 2, 3, 4, 5]
+  accepted ≡ 3
+  let len ← ch.len
+  len ≡ 3
+
+test "sendAll on closed channel accepts nothing" := do
+  let ch ← Channel.newBuffered Nat 5
+  ch.close
+  let accepted ← ch.sendAll #[1, 2]
+  accepted ≡ 0
+
+test "recvUpTo drains available values in order" := do
+  let ch ← Channel.newBuffered Nat 5
+  let _ ← ch.sendAll #[10, 20, 30]
+  let values ← ch.recvUpTo 2
+  values ≡ #[10, 20]
+  let rest ← ch.recvUpTo 10
+  rest ≡ #[30]
+
+test "recvUpTo on empty channel returns empty array" := do
+  let ch ← Channel.newBuffered Nat 5
+  let values ← ch.recvUpTo 10
+  values ≡ #[]
+
+test "recvMany drains available values in one call" := do
+  let ch ← Channel.newBuffered Nat 10
+  let _ ← ch.sendAll #[1, 2, 3, 4]
+  let values ← ch.recvMany 10
+  values ≡ #[1, 2, 3, 4]
+
+test "recvMany respects max" := do
+  let ch ← Channel.newBuffered Nat 10
+  let _ ← ch.sendAll #[1, 2, 3, 4]
+  let first ← ch.recvMany 3
+  first ≡ #[1, 2, 3]
+  let rest ← ch.recvMany 10
+  rest ≡ #[4]
+
+test "recvMany blocks until a value arrives" := do
+  let ch ← Channel.newBuffered Nat 10
+  let task ← IO.asTask (prio := .dedicated) do
+    ch.recvMany 10
+  IO.sleep 10
+  let _ ← ch.send 42
+  let v ← IO.wait task
+  match v with
+  | .ok arr => arr ≡ #[42]
+  | _ => throw (IO.userError "expected recvMany to return #[42]")
+
+test "recvMany on closed drained channel returns empty" := do
+  let ch ← Channel.newBuffered Nat 10
+  ch.close
+  let values ← ch.recvMany 10
+  values ≡ #[]
+
+test "sendAll then recvUpTo round-trips a batch" := do
+  let ch ← Channel.newBuffered Nat 100
+  let batch := (Array.range 100)
+  let accepted ← ch.sendAll batch
+  accepted ≡ 100
+  let values ← ch.recvUpTo 100
+  values ≡ batch
+
+testSuite "Overwrite Send"
+
+test "sendOverwrite evicts oldest when full" := do
+  let ch ← Channel.newBuffered Nat 2
+  let _ ← ch.sendOverwrite 1
+  let _ ← ch.sendOverwrite 2
+  let _ ← ch.sendOverwrite 3
+  let v1 ← ch.recv
+  let v2 ← ch.recv
+  v1 ≡? 2
+  v2 ≡? 3
+
+test "capacity-1 channel conflates to latest value" := do
+  let ch ← Channel.newBuffered Nat 1
+  for i in [:5] do
+    let _ ← ch.sendOverwrite i
+  let v ← ch.recv
+  v ≡? 4
+  let len ← ch.len
+  len ≡ 0
+
+test "dropped counts evictions" := do
+  let ch ← Channel.newBuffered Nat 2
+  let _ ← ch.sendOverwrite 1
+  let _ ← ch.sendOverwrite 2
+  let d0 ← ch.dropped
+  d0 ≡ 0
+  let _ ← ch.sendOverwrite 3
+  let _ ← ch.sendOverwrite 4
+  let d ← ch.dropped
+  d ≡ 2
+
+test "sendOverwrite on closed channel returns false" := do
+  let ch ← Channel.newBuffered Nat 2
+  ch.close
+  let r ← ch.sendOverwrite 1
+  r ≡ false
+
+testSuite "Unbounded Channel"
+
+test "create unbounded channel" := do
+  let ch ← Channel.newUnbounded Nat
+  let cap ← ch.capacity
+  cap ≡ 0
+  let len ← ch.len
+  len ≡ 0
+
+test "send never blocks and len tracks depth" := do
+  let ch ← Channel.newUnbounded Nat
+  for i in [:1000] do
+    let r ← ch.send i
+    r ≡ true
+  let len ← ch.len
+  len ≡ 1000
+
+test "values drain in FIFO order across segments" := do
+  let ch ← Channel.newUnbounded Nat
+  -- More than one 256-slot segment
+  for i in [:600] do
+    let _ ← ch.send i
+  ch.close
+  let arr ← ch.drain
+  arr ≡ Array.range 600
+
+test "trySend always succeeds while open" := do
+  let ch ← Channel.newUnbounded Nat
+  let r ← ch.trySend 1
+  r.isOk ≡ true
+  ch.close
+  let r2 ← ch.trySend 2
+  r2.isClosed ≡ true
+
+test "recv blocks until a value arrives" := do
+  let ch ← Channel.newUnbounded Nat
+  let task ← IO.asTask (prio := .dedicated) do
+    ch.recv
+  IO.sleep 10
+  let _ ← ch.send 42
+  let v ← IO.wait task
+  match v with
+  | .ok (some n) => n ≡ 42
+  | _ => throw (IO.userError "expected recv to return 42")
+
+test "close drains remaining values then returns none" := do
+  let ch ← Channel.newUnbounded String
+  let _ ← ch.send "a"
+  let _ ← ch.send "b"
+  ch.close
+  let v1 ← ch.recv
+  let v2 ← ch.recv
+  let v3 ← ch.recv
+  v1 ≡? "a"
+  v2 ≡? "b"
+  shouldBeNone v3
+
+test "sendAll accepts the whole batch" := do
+  let ch ← Channel.newUnbounded Nat
+  let accepted ← ch.sendAll (Array.range 500)
+  accepted ≡ 500
+  let values ← ch.recvUpTo 500
+  values ≡ Array.range 500
+
+testSuite "Channel Stats"
+
+test "stats are zero without enableStats" := do
+  let ch ← Channel.newBuffered Nat 4
+  let _ ← ch.send 1
+  let st ← ch.stats
+  st.sends ≡ 0
+  st.recvs ≡ 0
+
+test "stats count sends and recvs" := do
+  let ch ← Channel.newBuffered Nat 4
+  ch.enableStats
+  let _ ← ch.send 1
+  let _ ← ch.send 2
+  let _ ← ch.recv
+  let st ← ch.stats
+  st.sends ≡ 2
+  st.recvs ≡ 1
+  st.highWater ≡ 2
+
+test "stats record send-blocked events" := do
+  let ch ← Channel.newBuffered Nat 1
+  ch.enableStats
+  let _ ← ch.send 1  -- fills the buffer
+  let task ← IO.asTask (prio := .dedicated) do
+    ch.send 2  -- must block until the recv below
+  IO.sleep 10
+  let _ ← ch.recv
+  let _ ← IO.wait task
+  let st ← ch.stats
+  st.sendBlocks ≡ 1
+  (st.blockedNanos > 0) ≡ true
+
+testSuite "Lazy Buffer Growth"
+
+test "large-capacity channel works through growth and wrap-around" := do
+  let ch ← Channel.newBuffered Nat 1000
+  -- Interleave sends and receives so the ring grows and wraps mid-stream
+  for round in [:5] do
+    for i in [:30] do
+      let _ ← ch.send (round * 30 + i)
+    for i in [:30] do
+      (← ch.recv) ≡? (round * 30 + i)
+  (← ch.len) ≡ 0
+
+test "capacity still reports the declared bound" := do
+  let ch ← Channel.newBuffered Nat 16384
+  let _ ← ch.send 1
+  (← ch.capacity) ≡ 16384
+  (← ch.len) ≡ 1
+
+test "channel fills to full declared capacity" := do
+  let ch ← Channel.newBuffered Nat 100
+  for i in [:100] do
+    let _ ← ch.send i
+  (← ch.len) ≡ 100
+  -- Buffer is full: trySend must report full, not grow past the bound
+  let r ← ch.trySend 999
+  r.isFull ≡ true
+  for i in [:100] do
+    (← ch.recv) ≡? i
+
+testSuite "Prioritized Channel"
+
+test "priority values are received before queued bulk data" := do
+  let ch ← Channel.newPrioritized Nat 100
+  for i in [:50] do
+    let _ ← ch.send i
+  let _ ← ch.sendPriority 999
+  (← ch.recv) ≡? 999
+  (← ch.recv) ≡? 0
+
+test "priority lane is FIFO within itself" := do
+  let ch ← Channel.newPrioritized Nat 10
+  let _ ← ch.send 1
+  let _ ← ch.sendPriority 100
+  let _ ← ch.sendPriority 101
+  (← ch.recv) ≡? 100
+  (← ch.recv) ≡? 101
+  (← ch.recv) ≡? 1
+
+test "close drains both lanes before recv returns none" := do
+  let ch ← Channel.newPrioritized Nat 10
+  let _ ← ch.send 1
+  let _ ← ch.sendPriority 100
+  ch.close
+  (← ch.recv) ≡? 100
+  (← ch.recv) ≡? 1
+  shouldBeNone (← ch.recv)
+
+test "sendPriority on closed channel returns false" := do
+  let ch ← Channel.newPrioritized Nat 10
+  ch.close
+  (← ch.sendPriority 1) ≡ false
+
+test "len counts both lanes" := do
+  let ch ← Channel.newPrioritized Nat 10
+  let _ ← ch.send 1
+  let _ ← ch.sendPriority 2
+  (← ch.len) ≡ 2
+
+testSuite "High-Water Callbacks"
+
+test "onHighWater fires when depth reaches threshold" := do
+  let ch ← Channel.newBuffered Nat 8
+  let fired ← IO.mkRef 0
+  ch.onHighWater 3 (fired.modify (· + 1))
+  let _ ← ch.send 1
+  let _ ← ch.send 2
+  (← fired.get) ≡ 0
+  let _ ← ch.send 3
+  (← fired.get) ≡ 1
+
+test "onHighWater is edge-triggered" := do
+  let ch ← Channel.newBuffered Nat 8
+  let fired ← IO.mkRef 0
+  ch.onHighWater 2 (fired.modify (· + 1))
+  for i in [:6] do
+    let _ ← ch.send i
+  -- Depth stayed at or above the threshold, so one crossing = one fire
+  (← fired.get) ≡ 1
+
+test "onHighWater re-arms after depth drops below threshold" := do
+  let ch ← Channel.newBuffered Nat 8
+  let fired ← IO.mkRef 0
+  ch.onHighWater 2 (fired.modify (· + 1))
+  let _ ← ch.send 1
+  let _ ← ch.send 2
+  (← fired.get) ≡ 1
+  let _ ← ch.recv
+  let _ ← ch.recv
+  let _ ← ch.send 3
+  let _ ← ch.send 4
+  (← fired.get) ≡ 2
+
+test "len tracks depth without taking the channel lock" := do
+  let ch ← Channel.newBuffered Nat 4
+  (← ch.len) ≡ 0
+  let _ ← ch.send 1
+  let _ ← ch.send 2
+  (← ch.len) ≡ 2
+  let _ ← ch.recv
+  (← ch.len) ≡ 1
+
+testSuite "Wait Modes"
+
+test "hybrid handoff round-trips values" := do
+  let ch ← Channel.new Nat
+  ch.setWaitMode .hybrid
+  let sender ← IO.asTask (prio := .dedicated) do
+    for i in [:50] do
+      let _ ← ch.send i
+  for i in [:50] do
+    (← ch.recv) ≡? i
+  let _ ← IO.wait sender
+
+test "spin handoff round-trips values" := do
+  let ch ← Channel.new Nat
+  ch.setWaitMode .spin
+  let echo ← IO.asTask (prio := .dedicated) do
+    for v in ch do
+      let _ ← ch.send (v + 1)
+  -- Ping-pong through the same channel: each round is two rendezvous
+  let _ ← ch.send 10
+  (← ch.recv) ≡? 11
+  ch.close
+  let _ ← IO.wait echo
+
+test "spinning sender observes close" := do
+  let ch ← Channel.new Nat
+  ch.setWaitMode .spin
+  let sender ← IO.asTask (prio := .dedicated) do
+    ch.send 1
+  IO.sleep 20
+  ch.close
+  match ← IO.wait sender with
+  | .ok ok => ok ≡ false
+  | .error e => throw e
+
+test "setWaitMode park restores default behavior" := do
+  let ch ← Channel.new Nat
+  ch.setWaitMode .hybrid
+  ch.setWaitMode .park
+  let sender ← IO.asTask (prio := .dedicated) do
+    let _ ← ch.send 7
+  (← ch.recv) ≡? 7
+  let _ ← IO.wait sender
 
 end ConduitTests.ChannelTests
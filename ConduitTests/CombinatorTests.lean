@@ -27,6 +27,17 @@ test "fromArray creates closed channel with values" := do
   v3 ≡? 3
   shouldBeNone v4
 
+test "fromArray on an empty array is closed and drained" := do
+  let ch ← Channel.fromArray (#[] : Array Nat)
+  (← ch.isClosed) ≡ true
+  shouldBeNone (← ch.recv)
+
+test "fromArray preserves order for a large batch" := do
+  let ch ← Channel.fromArray (Array.range 10000)
+  (← ch.len) ≡ 10000
+  let out ← ch.drain
+  out ≡ Array.range 10000
+
 test "singleton creates single-value channel" := do
   let ch ← Channel.singleton "hello"
   let v1 ← ch.recv
@@ -202,6 +213,73 @@ test "filter closes output when input closes" := do
   let closed ← output.isClosed
   closed ≡ true
 
+testSuite "parMap"
+
+test "parMap transforms every value" := do
+  let input ← Channel.fromArray (Array.range 20)
+  let output ← input.parMap (· * 2) (workers := 4)
+  let results ← output.drain
+  results.qsort (· < ·) ≡ (Array.range 20).map (· * 2)
+
+test "parMap ordered preserves input order" := do
+  let input ← Channel.fromArray (Array.range 50)
+  let output ← input.parMap (· + 1) (workers := 4) (ordered := true)
+  let results ← output.drain
+  results ≡ (Array.range 50).map (· + 1)
+
+test "parMap ordered with one worker" := do
+  let input ← Channel.fromArray #[3, 1, 4, 1, 5]
+  let output ← input.parMap (· * 10) (workers := 1) (ordered := true)
+  let results ← output.drain
+  results ≡ #[30, 10, 40, 10, 50]
+
+test "parMap closes output when input closes" := do
+  let input ← Channel.fromArray #[1, 2]
+  let output ← input.parMap id (workers := 2)
+  let _ ← output.drain
+  let closed ← output.isClosed
+  closed ≡ true
+
+test "parMap on empty closed channel yields nothing" := do
+  let input ← Channel.empty Nat
+  let output ← input.parMap (· + 1) (workers := 3)
+  let results ← output.drain
+  results ≡ #[]
+
+testSuite "recvAny"
+
+test "recvAny takes from the ready channel" := do
+  let ch1 ← Channel.newBuffered Nat 4
+  let ch2 ← Channel.newBuffered Nat 4
+  let _ ← ch2.send 99
+  let result ← Channel.recvAny #[ch1, ch2] 0
+  result ≡? (1, 99)
+
+test "recvAny returns none when all inputs are exhausted" := do
+  let ch1 ← Channel.empty Nat
+  let ch2 ← Channel.empty Nat
+  let result ← Channel.recvAny #[ch1, ch2] 0
+  shouldBeNone result
+
+test "recvAny blocks until a value arrives" := do
+  let ch1 ← Channel.newBuffered Nat 4
+  let ch2 ← Channel.newBuffered Nat 4
+  let task ← IO.asTask (prio := .dedicated) do
+    Channel.recvAny #[ch1, ch2] 0
+  IO.sleep 10
+  let _ ← ch1.send 7
+  let v ← IO.wait task
+  match v with
+  | .ok (some (0, 7)) => pure ()
+  | _ => throw (IO.userError "expected recvAny to return (0, 7)")
+
+test "recvAny skips closed inputs while others are open" := do
+  let ch1 ← Channel.empty Nat
+  let ch2 ← Channel.newBuffered Nat 4
+  let _ ← ch2.send 5
+  let result ← Channel.recvAny #[ch1, ch2] 0
+  result ≡? (1, 5)
+
 testSuite "merge"
 
 test "merge combines values from multiple channels" := do
@@ -230,6 +308,14 @@ test "merge with single channel" := do
   let results ← merged.drain
   results ≡ #[1, 2, 3]
 
+test "merge preserves per-input FIFO order" := do
+  let ch1 ← Channel.fromArray #[1, 2, 3]
+  let ch2 ← Channel.fromArray #[10, 20, 30]
+  let merged ← Channel.merge #[ch1, ch2]
+  let results ← merged.drain
+  results.filter (· < 10) ≡ #[1, 2, 3]
+  results.filter (· ≥ 10) ≡ #[10, 20, 30]
+
 test "merge with empty array" := do
   let merged ← Channel.merge (#[] : Array (Channel Nat))
   let closed ← merged.isClosed
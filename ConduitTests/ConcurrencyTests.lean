@@ -411,6 +411,28 @@ test "rapid send-recv-close cycle" := do
   -- If we get here without hanging or crashing, test passes
   pure ()
 
+testSuite "Cancellation"
 
+test "cancel wakes a blocked recv" := do
+  let ch ← Channel.new Nat
+  let task ← IO.asTask (prio := .dedicated) do
+    ch.recv
+  IO.sleep 5
+  Conduit.cancel task
+  -- The blocked recv should complete as if the channel were closed
+  match ← IO.wait task with
+  | .ok r => shouldBeNone r
+  | .error e => throw e
+
+test "cancel wakes a blocked send" := do
+  let ch ← Channel.newBuffered Nat 1
+  let _ ← ch.send 1  -- fill the buffer
+  let task ← IO.asTask (prio := .dedicated) do
+    ch.send 2
+  IO.sleep 5
+  Conduit.cancel task
+  match ← IO.wait task with
+  | .ok sent => sent ≡ false
+  | .error e => throw e
 
 end ConduitTests.ConcurrencyTests
@@ -0,0 +1,142 @@
+/-
+  ConduitTests.LockFreeTests
+
+  Tests for lock-free MPMC channels.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.LockFreeTests
+
+open Crucible
+open Conduit
+
+testSuite "Lock-Free Channel"
+
+test "create lock-free channel" := do
+  let ch ← Channel.newLockFree Nat 8
+  let cap ← ch.capacity
+  cap ≡ 8
+
+test "trySend and tryRecv round-trip" := do
+  let ch ← Channel.newLockFree Nat 4
+  let r ← ch.trySend 42
+  r.isOk ≡ true
+  let result ← ch.tryRecv
+  match result with
+  | .ok v => v ≡ 42
+  | _ => throw (IO.userError "expected .ok 42")
+
+test "trySend reports full ring" := do
+  let ch ← Channel.newLockFree Nat 2
+  let _ ← ch.trySend 1
+  let _ ← ch.trySend 2
+  let r ← ch.trySend 3
+  r.isFull ≡ true
+
+test "tryRecv reports empty and closed" := do
+  let ch ← Channel.newLockFree Nat 2
+  let r1 ← ch.tryRecv
+  r1.isEmpty ≡ true
+  ch.close
+  let r2 ← ch.tryRecv
+  r2.isClosed ≡ true
+
+test "blocking recv drains then returns none after close" := do
+  let ch ← Channel.newLockFree Nat 4
+  let _ ← ch.send 1
+  let _ ← ch.send 2
+  ch.close
+  let v1 ← ch.recv
+  let v2 ← ch.recv
+  let v3 ← ch.recv
+  v1 ≡? 1
+  v2 ≡? 2
+  shouldBeNone v3
+
+test "FIFO order preserved" := do
+  let ch ← Channel.newLockFree Nat 16
+  for i in [:16] do
+    let _ ← ch.send i
+  ch.close
+  let arr ← ch.drain
+  arr ≡ Array.range 16
+
+test "concurrent producers and consumers deliver all values" := do
+  let ch ← Channel.newLockFree Nat 64
+  let producers ← (List.range 4).mapM fun batch =>
+    IO.asTask (prio := .dedicated) do
+      for i in [:250] do
+        let _ ← ch.send (batch * 250 + i)
+  let total ← IO.mkRef 0
+  let consumers ← (List.range 4).mapM fun _ =>
+    IO.asTask (prio := .dedicated) do
+      for _ in ch do
+        total.modify (· + 1)
+  for p in producers do
+    let _ ← IO.wait p
+  ch.close
+  for c in consumers do
+    let _ ← IO.wait c
+  let n ← total.get
+  n ≡ 1000
+
+test "select recv works on lock-free channel" := do
+  let ch ← Channel.newLockFree Nat 4
+  let _ ← ch.send 7
+  let idx ← Conduit.select do
+    Conduit.recvCase ch
+  idx ≡? 0
+
+testSuite "SPSC Channel"
+
+test "create spsc channel" := do
+  let ch ← Channel.newSpsc Nat 8
+  let cap ← ch.capacity
+  cap ≡ 8
+
+test "trySend and tryRecv round-trip" := do
+  let ch ← Channel.newSpsc Nat 4
+  let r ← ch.trySend 9
+  r.isOk ≡ true
+  let result ← ch.tryRecv
+  match result with
+  | .ok v => v ≡ 9
+  | _ => throw (IO.userError "expected .ok 9")
+
+test "trySend reports full ring" := do
+  let ch ← Channel.newSpsc Nat 2
+  let _ ← ch.trySend 1
+  let _ ← ch.trySend 2
+  let r ← ch.trySend 3
+  r.isFull ≡ true
+
+test "close drains then returns none" := do
+  let ch ← Channel.newSpsc Nat 4
+  let _ ← ch.send 1
+  let _ ← ch.send 2
+  ch.close
+  let v1 ← ch.recv
+  let v2 ← ch.recv
+  let v3 ← ch.recv
+  v1 ≡? 1
+  v2 ≡? 2
+  shouldBeNone v3
+
+test "single producer feeds single consumer" := do
+  let ch ← Channel.newSpsc Nat 32
+  let producer ← IO.asTask (prio := .dedicated) do
+    for i in [:2000] do
+      let _ ← ch.send i
+    ch.close
+  let received ← IO.mkRef 0
+  let consumer ← IO.asTask (prio := .dedicated) do
+    for _ in ch do
+      received.modify (· + 1)
+  let _ ← IO.wait producer
+  let _ ← IO.wait consumer
+  let n ← received.get
+  n ≡ 2000
+
+end ConduitTests.LockFreeTests
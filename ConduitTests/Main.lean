@@ -17,6 +17,14 @@ import ConduitTests.BroadcastTests
 import ConduitTests.EdgeCaseTests
 import ConduitTests.StressTests
 import ConduitTests.ResourceTests
+import ConduitTests.LockFreeTests
+import ConduitTests.ScalarChannelTests
+import ConduitTests.BytesChannelTests
+import ConduitTests.ShmChannelTests
+import ConduitTests.PipelineTests
+import ConduitTests.ShardedTests
+import ConduitTests.TelemetryTests
+import ConduitTests.RendezvousTests
 
 open Crucible
 
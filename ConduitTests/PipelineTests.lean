@@ -0,0 +1,61 @@
+/-
+  ConduitTests.PipelineTests
+
+  Tests for fused pipelines.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.PipelineTests
+
+open Crucible
+open Conduit
+
+testSuite "Pipeline"
+
+test "empty pipeline passes values through" := do
+  let input ← Channel.fromArray #[1, 2, 3]
+  let output ← (Pipeline.start Nat).run input
+  let results ← output.drain
+  results ≡ #[1, 2, 3]
+
+test "map stage transforms values" := do
+  let input ← Channel.fromArray #[1, 2, 3]
+  let output ← ((Pipeline.start Nat).map (· * 2)).run input
+  let results ← output.drain
+  results ≡ #[2, 4, 6]
+
+test "filter stage drops values" := do
+  let input ← Channel.fromArray #[1, 2, 3, 4, 5]
+  let output ← ((Pipeline.start Nat).filter (· % 2 == 0)).run input
+  let results ← output.drain
+  results ≡ #[2, 4]
+
+test "chained stages fuse into one pass" := do
+  let input ← Channel.fromArray #[1, 2, 3, 4, 5]
+  let pipeline := Pipeline.start Nat
+    |>.filter (· > 2)
+    |>.map (· * 10)
+    |>.map toString
+  let output ← pipeline.run input
+  let results ← output.drain
+  results ≡ #["30", "40", "50"]
+
+test "filter after map sees mapped values" := do
+  let input ← Channel.fromArray #[1, 2, 3]
+  let pipeline := Pipeline.start Nat
+    |>.map (· * 10)
+    |>.filter (· ≥ 20)
+  let output ← pipeline.run input
+  let results ← output.drain
+  results ≡ #[20, 30]
+
+test "pipeline closes output when input closes" := do
+  let input ← Channel.fromArray #[1]
+  let output ← ((Pipeline.start Nat).map (· + 1)).run input
+  let _ ← output.drain
+  let closed ← output.isClosed
+  closed ≡ true
+
+end ConduitTests.PipelineTests
@@ -0,0 +1,103 @@
+/-
+  ConduitTests.RendezvousTests
+
+  Tests for the request/reply rendezvous.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.RendezvousTests
+
+open Crucible
+open Conduit
+
+testSuite "Rendezvous"
+
+test "call receives the server's reply" := do
+  let r ← Rendezvous.new Nat Nat
+  let server ← IO.asTask (prio := .dedicated) do
+    r.serve fun n => pure (n * 2)
+  let reply ← r.call 21
+  reply ≡? 42
+  r.close
+  let _ ← IO.wait server
+
+test "callers are served in order" := do
+  let r ← Rendezvous.new Nat Nat
+  let served ← Channel.newBuffered Nat 16
+  let server ← IO.asTask (prio := .dedicated) do
+    r.serve fun n => do
+      let _ ← served.send n
+      pure n
+  for i in [:5] do
+    let reply ← r.call i
+    reply ≡? i
+  r.close
+  let _ ← IO.wait server
+  served.close
+  let order ← served.drain
+  order ≡ #[0, 1, 2, 3, 4]
+
+test "call on closed rendezvous returns none" := do
+  let r ← Rendezvous.new Nat Nat
+  r.close
+  let reply ← r.call 1
+  shouldBeNone reply
+
+test "close wakes a parked caller with none" := do
+  let r ← Rendezvous.new Nat Nat
+  let caller ← IO.asTask (prio := .dedicated) do
+    r.call 7
+  IO.sleep 20
+  r.close
+  match ← IO.wait caller with
+  | .ok none => pure ()
+  | _ => throw (IO.userError "expected call to return none on close")
+
+test "serve returns after close with no pending calls" := do
+  let r ← Rendezvous.new Nat Nat
+  let server ← IO.asTask (prio := .dedicated) do
+    r.serve fun n => pure n
+  IO.sleep 10
+  r.close
+  match ← IO.wait server with
+  | .ok () => pure ()
+  | .error e => throw e
+
+test "concurrent callers each get their own reply" := do
+  let r ← Rendezvous.new Nat Nat
+  let server ← IO.asTask (prio := .dedicated) do
+    r.serve fun n => pure (n + 100)
+  let mut callers := #[]
+  for i in [:8] do
+    let t ← IO.asTask (prio := .dedicated) do
+      r.call i
+    callers := callers.push (i, t)
+  for (i, t) in callers do
+    match ← IO.wait t with
+    | .ok (some v) => v ≡ i + 100
+    | _ => throw (IO.userError "expected a reply for every caller")
+  r.close
+  let _ ← IO.wait server
+
+test "handler failure wakes the caller with none" := do
+  let r ← Rendezvous.new Nat Nat
+  let server ← IO.asTask (prio := .dedicated) do
+    r.serve fun _ => throw (IO.userError "handler failed")
+  let reply ← r.call 1
+  shouldBeNone reply
+  match ← IO.wait server with
+  | .error _ => pure ()
+  | .ok () => throw (IO.userError "expected serve to propagate the handler error")
+  r.close
+
+test "isClosed reflects close" := do
+  let r ← Rendezvous.new Nat Nat
+  (← r.isClosed) ≡ false
+  r.close
+  (← r.isClosed) ≡ true
+  r.close -- idempotent
+  (← r.isClosed) ≡ true
+
+end ConduitTests.RendezvousTests
@@ -196,6 +196,33 @@ test "broadcast hub does not leak subscribers" := do
   -- source channel + 3 subscriber channels
   allocs ≡ 4
 
+testSuite "Channel Pool"
 
+test "getPoolStats returns counts" := do
+  let (_, _) ← Channel.Debug.getPoolStats
+  -- Just verify we can call it without crashing
+  pure ()
+
+test "pooled channel behaves like a fresh one" := do
+  -- Exercise create/use/drop repeatedly; later iterations are likely served
+  -- from the pool and must be indistinguishable from cold channels.
+  for round in [:20] do
+    let ch ← Channel.newBuffered Nat 4
+    let _ ← ch.send round
+    let v ← ch.recv
+    v ≡? round
+    let closed ← ch.isClosed
+    closed ≡ false
+    ch.close
+
+test "alloc and pool counters stay consistent" := do
+  Channel.Debug.resetAllocStats
+  for _ in [:10] do
+    let ch ← Channel.newBuffered Nat 8
+    ch.close
+  let (allocs, _) ← Channel.Debug.getAllocStats
+  let (hits, cold) ← Channel.Debug.getPoolStats
+  -- Every creation was either a pool hit or a cold allocation
+  allocs ≡ (hits + cold)
 
 end ConduitTests.ResourceTests
@@ -0,0 +1,106 @@
+/-
+  ConduitTests.ScalarChannelTests
+
+  Tests for unboxed UInt64/Float channels.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.ScalarChannelTests
+
+open Crucible
+open Conduit
+
+testSuite "UInt64 Channel"
+
+test "create with capacity" := do
+  let ch ← Channel.UInt64.new 8
+  let cap ← ch.capacity
+  cap ≡ 8
+
+test "send and recv round-trip" := do
+  let ch ← Channel.UInt64.new 4
+  let _ ← ch.send 0xDEADBEEF
+  let v ← ch.recv
+  v ≡? 0xDEADBEEF
+
+test "FIFO order preserved" := do
+  let ch ← Channel.UInt64.new 8
+  let _ ← ch.send 1
+  let _ ← ch.send 2
+  let _ ← ch.send 3
+  let v1 ← ch.recv
+  let v2 ← ch.recv
+  let v3 ← ch.recv
+  v1 ≡? 1
+  v2 ≡? 2
+  v3 ≡? 3
+
+test "close drains then returns none" := do
+  let ch ← Channel.UInt64.new 4
+  let _ ← ch.send 42
+  ch.close
+  let v1 ← ch.recv
+  let v2 ← ch.recv
+  v1 ≡? 42
+  shouldBeNone v2
+
+test "trySend reports full and closed" := do
+  let ch ← Channel.UInt64.new 1
+  let r1 ← ch.trySend 1
+  r1.isOk ≡ true
+  let r2 ← ch.trySend 2
+  r2.isFull ≡ true
+  ch.close
+  let r3 ← ch.trySend 3
+  r3.isClosed ≡ true
+
+test "tryRecv reports empty" := do
+  let ch ← Channel.UInt64.new 4
+  let r ← ch.tryRecv
+  r.isEmpty ≡ true
+
+test "concurrent producer and consumer" := do
+  let ch ← Channel.UInt64.new 64
+  let producer ← IO.asTask (prio := .dedicated) do
+    for i in [:1000] do
+      let _ ← ch.send (UInt64.ofNat i)
+    ch.close
+  let sum ← IO.mkRef (0 : UInt64)
+  let consumer ← IO.asTask (prio := .dedicated) do
+    for _ in [:1000] do
+      match ← ch.recv with
+      | some v => sum.modify (· + v)
+      | none => pure ()
+  let _ ← IO.wait producer
+  let _ ← IO.wait consumer
+  let total ← sum.get
+  total ≡ 499500
+
+testSuite "Float Channel"
+
+test "send and recv round-trip" := do
+  let ch ← Channel.Float.new 4
+  let _ ← ch.send 3.25
+  let v ← ch.recv
+  v ≡? 3.25
+
+test "close drains then returns none" := do
+  let ch ← Channel.Float.new 4
+  let _ ← ch.send 1.5
+  ch.close
+  let v1 ← ch.recv
+  let v2 ← ch.recv
+  v1 ≡? 1.5
+  shouldBeNone v2
+
+test "tryRecv returns value when available" := do
+  let ch ← Channel.Float.new 4
+  let _ ← ch.send 2.75
+  let r ← ch.tryRecv
+  match r with
+  | .ok v => v ≡ 2.75
+  | _ => throw (IO.userError "expected .ok 2.75")
+
+end ConduitTests.ScalarChannelTests
@@ -188,6 +188,15 @@ test "selectWait wakes on channel close" := do
   -- Closed channel is ready for recv (returns none)
   result ≡? 0
 
+test "selectWait returns none when every send case is already closed" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  ch1.close
+  ch2.close
+  -- No case can ever fire and no notification will arrive; must not hang
+  let result ← selectWait (do sendCase ch1 1; sendCase ch2 2)
+  shouldBeNone result
+
 test "selectWait with send case blocks until space" := do
   let ch ← Channel.newBuffered Nat 1
   let _ ← ch.send 1  -- Fill buffer
@@ -303,6 +312,212 @@ test "selectTimeout respects timeout" := do
   if elapsed - start >= 300 then
     throw (IO.userError s!"Timeout too slow: {elapsed - start}ms")
 
+testSuite "Select Wakeup"
+
+test "concurrent selectors on one channel all get served" := do
+  let ch ← Channel.newBuffered Nat 4
+  let done ← Channel.newBuffered Nat 8
+  -- Four selectors parked on the same channel: each send should wake one.
+  let selectors ← (List.range 4).mapM fun id =>
+    IO.asTask (prio := .dedicated) do
+      for _ in [:5] do
+        let idx ← selectWait (recvCase ch)
+        if idx == some 0 then
+          let _ ← ch.recv
+          pure ()
+      let _ ← done.send id
+      pure ()
+  for i in [:20] do
+    let _ ← ch.send i
+    IO.sleep 1
+  for _ in [:4] do
+    let _ ← done.recv
+    pure ()
+  for s in selectors do
+    let _ ← IO.wait s
+
+test "send-side selector wakes when space frees up" := do
+  let ch ← Channel.newBuffered Nat 1
+  let _ ← ch.send 1  -- Fill buffer
+  let _ ← IO.asTask (prio := .dedicated) do
+    IO.sleep 30
+    let _ ← ch.recv
+    pure ()
+  let result ← selectWait (sendCase ch 2)
+  result ≡? 0
+
+testSuite "Select.Prepared"
 
+test "prepared poll returns ready case index" := do
+  let ch1 ← Channel.newBuffered Nat 3
+  let ch2 ← Channel.newBuffered Nat 3
+  let prepared ← selectPrepare do
+    recvCase ch1
+    recvCase ch2
+  let r1 ← prepared.poll
+  shouldBeNone r1
+  let _ ← ch2.send 42
+  let r2 ← prepared.poll
+  r2 ≡? 1
+
+test "prepared wait returns immediately when ready" := do
+  let ch ← Channel.newBuffered Nat 1
+  let _ ← ch.send 42
+  let prepared ← selectPrepare (recvCase ch)
+  let result ← prepared.wait
+  result ≡? 0
+
+test "prepared wait blocks until channel ready" := do
+  let ch ← Channel.newBuffered Nat 1
+  let prepared ← selectPrepare (recvCase ch)
+  let _ ← IO.asTask (prio := .dedicated) do
+    IO.sleep 30
+    let _ ← ch.send 42
+    pure ()
+  let result ← prepared.wait
+  result ≡? 0
+
+test "prepared waitTimeout returns none on timeout" := do
+  let ch ← Channel.newBuffered Nat 1
+  let prepared ← selectPrepare (recvCase ch)
+  let result ← prepared.waitTimeout 20
+  shouldBeNone result
+
+test "prepared handle is reusable across many waits" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let prepared ← selectPrepare do
+    recvCase ch1
+    recvCase ch2
+  for i in [:100] do
+    let target := if i % 2 == 0 then ch1 else ch2
+    let _ ← target.send i
+    let idx ← prepared.wait
+    idx ≡? (i % 2)
+    let _ ← target.recv
+    pure ()
+
+test "prepared wait wakes on close" := do
+  let ch ← Channel.newBuffered Nat 1
+  let prepared ← selectPrepare (recvCase ch)
+  let _ ← IO.asTask (prio := .dedicated) do
+    IO.sleep 30
+    ch.close
+  let result ← prepared.wait
+  result ≡? 0
+
+testSuite "Select.pollAll"
+
+test "pollAll returns empty when nothing ready" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let ready ← selectPollAll do
+    recvCase ch1
+    recvCase ch2
+  ready ≡ #[]
+
+test "pollAll returns every ready index in case order" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let ch3 ← Channel.newBuffered Nat 1
+  let _ ← ch1.send 1
+  let _ ← ch3.send 3
+  let ready ← selectPollAll do
+    recvCase ch1
+    recvCase ch2
+    recvCase ch3
+  ready ≡ #[0, 2]
+
+test "pollAll mixes send and recv readiness" := do
+  let full ← Channel.newBuffered Nat 1
+  let _ ← full.send 1
+  let open_ ← Channel.newBuffered Nat 1
+  let ready ← selectPollAll do
+    sendCase full 9
+    sendCase open_ 9
+    recvCase full
+  ready ≡ #[1, 2]
+
+test "pollAll sees closed recv cases as ready" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  ch2.close
+  let ready ← selectPollAll do
+    recvCase ch1
+    recvCase ch2
+  ready ≡ #[1]
+
+test "prepared pollAll returns every ready index" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let prepared ← selectPrepare do
+    recvCase ch1
+    recvCase ch2
+  let r1 ← prepared.pollAll
+  r1 ≡ #[]
+  let _ ← ch1.send 1
+  let _ ← ch2.send 2
+  let r2 ← prepared.pollAll
+  r2 ≡ #[0, 1]
+
+testSuite "Select.fixedArity"
+
+test "recv2 reports the ready case" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let _ ← ch2.send 42
+  let tag ← Select.recv2 ch1 ch2
+  tag ≡ 1
+  (← ch2.recv) ≡? 42
+
+test "recv2 blocks until a value arrives" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let sender ← IO.asTask (prio := .dedicated) do
+    IO.sleep 10
+    let _ ← ch1.send 7
+  let tag ← Select.recv2 ch1 ch2
+  tag ≡ 0
+  (← ch1.recv) ≡? 7
+  let _ ← IO.wait sender
+
+test "recv2 sees a closed channel as ready" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  ch2.close
+  let tag ← Select.recv2 ch1 ch2
+  tag ≡ 1
+  shouldBeNone (← ch2.recv)
+
+test "recv3 reports the ready case" := do
+  let ch1 ← Channel.newBuffered Nat 1
+  let ch2 ← Channel.newBuffered Nat 1
+  let ch3 ← Channel.newBuffered Nat 1
+  let _ ← ch3.send 3
+  let tag ← Select.recv3 ch1 ch2 ch3
+  tag ≡ 2
+
+test "recvSend reports send readiness" := do
+  let recvCh ← Channel.newBuffered Nat 1
+  let sendCh ← Channel.newBuffered Nat 1
+  let tag ← Select.recvSend recvCh sendCh 9
+  tag ≡ 1
+  (← sendCh.trySend 9).isOk ≡ true
+
+test "recvSend prefers whichever case is ready" := do
+  let recvCh ← Channel.newBuffered Nat 1
+  let full ← Channel.newBuffered Nat 1
+  let _ ← full.send 1       -- send case blocked
+  let _ ← recvCh.send 5     -- recv case ready
+  let tag ← Select.recvSend recvCh full 9
+  tag ≡ 0
+
+test "recvSend with a closed send case still serves the recv case" := do
+  let recvCh ← Channel.newBuffered Nat 1
+  let closed ← Channel.newBuffered Nat 1
+  closed.close              -- send readiness on it can never fire
+  let _ ← recvCh.send 4
+  let tag ← Select.recvSend recvCh closed 9
+  tag ≡ 0
 
 end ConduitTests.SelectAdvancedTests
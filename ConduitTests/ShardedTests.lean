@@ -0,0 +1,94 @@
+/-
+  ConduitTests.ShardedTests
+
+  Tests for sharded channels.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.ShardedTests
+
+open Crucible
+open Conduit
+
+testSuite "Sharded Channel"
+
+test "create sharded channel with default shards" := do
+  let s ← Sharded.new Nat 64
+  s.shardCount ≡ 8
+
+test "shard count is clamped to at least 1" := do
+  let s ← Sharded.new Nat 16 (shards := 0)
+  s.shardCount ≡ 1
+
+test "send and recv round-trip" := do
+  let s ← Sharded.new Nat 16 (shards := 4)
+  let ok ← s.send 42
+  ok ≡ true
+  let v ← s.recv
+  v ≡? 42
+
+test "all values delivered across shards" := do
+  let s ← Sharded.new Nat 256 (shards := 4)
+  for i in [:100] do
+    let _ ← s.send i
+  s.close
+  let mut received : Array Nat := #[]
+  repeat
+    match ← s.recv with
+    | some v => received := received.push v
+    | none => break
+  -- No global ordering guarantee, so compare the sorted contents.
+  received.qsort (· < ·) ≡ Array.range 100
+
+test "tryRecv reports empty then closed" := do
+  let s ← Sharded.new Nat 16 (shards := 2)
+  let r1 ← s.tryRecv
+  r1.isEmpty ≡ true
+  s.close
+  let r2 ← s.tryRecv
+  r2.isClosed ≡ true
+
+test "trySend reports full when every shard is full" := do
+  let s ← Sharded.new Nat 4 (shards := 2)
+  for i in [:4] do
+    let _ ← s.send i
+  let r ← s.trySend 99
+  r.isFull ≡ true
+
+test "send on closed sharded channel returns false" := do
+  let s ← Sharded.new Nat 16 (shards := 2)
+  s.close
+  let ok ← s.send 1
+  ok ≡ false
+  let closed ← s.isClosed
+  closed ≡ true
+
+test "len sums queued values across shards" := do
+  let s ← Sharded.new Nat 64 (shards := 4)
+  for i in [:10] do
+    let _ ← s.send i
+  let n ← s.len
+  n ≡ 10
+
+test "concurrent producers and consumer deliver all values" := do
+  let s ← Sharded.new Nat 256 (shards := 4)
+  let producers ← (List.range 4).mapM fun batch =>
+    IO.asTask (prio := .dedicated) do
+      for i in [:250] do
+        let _ ← s.send (batch * 250 + i)
+  let total ← IO.mkRef 0
+  let consumer ← IO.asTask (prio := .dedicated) do
+    repeat
+      match ← s.recv with
+      | some _ => total.modify (· + 1)
+      | none => break
+  for p in producers do
+    let _ ← IO.wait p
+  s.close
+  let _ ← IO.wait consumer
+  let n ← total.get
+  n ≡ 1000
+
+end ConduitTests.ShardedTests
@@ -0,0 +1,102 @@
+/-
+  ConduitTests.ShmChannelTests
+
+  Tests for the shared-memory channel. Exercised within one process by
+  attaching a second handle to the segment the first one created; the
+  process-shared primitives behave identically either way.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.ShmChannelTests
+
+open Crucible
+open Conduit
+
+/-- Fresh segment path per test so runs never collide on stale files. -/
+def segPath (name : String) : IO String := do
+  let ms ← IO.monoMsNow
+  return s!"/tmp/conduit-shm-test-{name}-{ms}"
+
+def cleanup (path : String) : IO Unit := do
+  try IO.FS.removeFile path catch _ => pure ()
+
+testSuite "Shm Channel"
+
+test "create reports capacity and elemSize" := do
+  let path ← segPath "create"
+  let ch ← Channel.Shm.create path 8 16
+  (← ch.capacity) ≡ 8
+  (← ch.elemSize) ≡ 16
+  (← ch.len) ≡ 0
+  cleanup path
+
+test "send then recv round-trips a record" := do
+  let path ← segPath "roundtrip"
+  let ch ← Channel.Shm.create path 4 4
+  let ok ← ch.send (ByteArray.mk #[1, 2, 3, 4])
+  ok ≡ true
+  (← ch.len) ≡ 1
+  match ← ch.recv with
+  | some out => out.data ≡ #[1, 2, 3, 4]
+  | none => throw (IO.userError "expected a record")
+  cleanup path
+
+test "attach sees records sent through the creating handle" := do
+  let path ← segPath "attach"
+  let producer ← Channel.Shm.create path 4 2
+  let consumer ← Channel.Shm.attach path
+  let _ ← producer.send (ByteArray.mk #[7, 8])
+  match ← consumer.recv with
+  | some out => out.data ≡ #[7, 8]
+  | none => throw (IO.userError "expected a record")
+  cleanup path
+
+test "records are FIFO across wrap-around" := do
+  let path ← segPath "fifo"
+  let ch ← Channel.Shm.create path 2 1
+  let _ ← ch.send (ByteArray.mk #[1])
+  let _ ← ch.send (ByteArray.mk #[2])
+  let _ ← ch.recv
+  let _ ← ch.send (ByteArray.mk #[3])  -- tail wraps
+  (← ch.recv).map (·.data) ≡? #[2]
+  (← ch.recv).map (·.data) ≡? #[3]
+  cleanup path
+
+test "send with wrong record size errors" := do
+  let path ← segPath "badsize"
+  let ch ← Channel.Shm.create path 4 8
+  let r ← try
+    let _ ← ch.send (ByteArray.mk #[1, 2, 3])
+    pure false
+  catch _ =>
+    pure true
+  r ≡ true
+  cleanup path
+
+test "close propagates to attached handle and drains" := do
+  let path ← segPath "close"
+  let producer ← Channel.Shm.create path 4 1
+  let consumer ← Channel.Shm.attach path
+  let _ ← producer.send (ByteArray.mk #[9])
+  producer.close
+  (← consumer.isClosed) ≡ true
+  (← consumer.recv).map (·.data) ≡? #[9]
+  shouldBeNone (← consumer.recv)
+  let ok ← producer.send (ByteArray.mk #[1])
+  ok ≡ false
+  cleanup path
+
+test "attach on a non-segment file fails" := do
+  let path ← segPath "garbage"
+  IO.FS.writeFile path "not a segment"
+  let r ← try
+    let _ ← Channel.Shm.attach path
+    pure false
+  catch _ =>
+    pure true
+  r ≡ true
+  cleanup path
+
+end ConduitTests.ShmChannelTests
@@ -0,0 +1,42 @@
+/-
+  ConduitTests.TelemetryTests
+
+  Tests for the telemetry surface. These hold for both build flavors:
+  uninstrumented builds report disabled and all-zero histograms, and
+  instrumented builds are pinned to the same state here by toggling
+  recording off and resetting.
+-/
+
+import Conduit
+import Crucible
+
+namespace ConduitTests.TelemetryTests
+
+open Crucible
+open Conduit
+
+testSuite "Telemetry"
+
+test "snapshot has the expected histogram shape" := do
+  let t ← Telemetry.snapshot
+  t.send.buckets.size ≡ 64
+  t.recv.buckets.size ≡ 64
+  t.selectWait.buckets.size ≡ 64
+
+test "recording off means enabled reports false" := do
+  Telemetry.setEnabled false
+  (← Telemetry.enabled) ≡ false
+
+test "with recording off, traffic leaves histograms untouched" := do
+  Telemetry.setEnabled false
+  Telemetry.reset
+  let ch ← Channel.newBuffered Nat 4
+  let _ ← ch.send 1
+  let _ ← ch.recv
+  ch.close
+  let t ← Telemetry.snapshot
+  t.send.count ≡ 0
+  t.recv.count ≡ 0
+  t.send.meanNanos ≡ 0
+
+end ConduitTests.TelemetryTests
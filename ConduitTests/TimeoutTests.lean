@@ -124,6 +124,47 @@ test "recvTimeout wakes when sender arrives" := do
   if elapsed - start > 300 then
     throw (IO.userError s!"Too slow: {elapsed - start}ms")
 
+testSuite "Timer Channels"
 
+test "after delivers one value then closes" := do
+  let start ← IO.monoMsNow
+  let timer ← Channel.after 30
+  let v ← timer.recv
+  let elapsed ← IO.monoMsNow
+  v ≡? ()
+  if elapsed - start < 20 then
+    throw (IO.userError s!"Timer too fast: {elapsed - start}ms")
+  if elapsed - start > 300 then
+    throw (IO.userError s!"Timer too slow: {elapsed - start}ms")
+  let rest ← timer.recv
+  shouldBeNone rest
+  let closed ← timer.isClosed
+  closed ≡ true
+
+test "after composes with select" := do
+  let ch ← Channel.newBuffered Nat 1
+  let timer ← Channel.after 30
+  let idx ← Select.run do
+    Select.onRecv ch
+    Select.onRecv timer
+  idx ≡ 1
+
+test "ticker fires repeatedly until closed" := do
+  let tick ← Channel.ticker 10
+  let mut count := 0
+  for _ in [:3] do
+    match ← tick.recv with
+    | some _ => count := count + 1
+    | none => pure ()
+  count ≡ 3
+  tick.close
+  IO.sleep 30  -- Let the timer thread observe the close and retire it
+
+test "slow ticker receiver sees latest tick not a backlog" := do
+  let tick ← Channel.ticker 5
+  IO.sleep 50  -- Several ticks elapse unconsumed
+  let len ← tick.len
+  len ≡ 1
+  tick.close
 
 end ConduitTests.TimeoutTests
@@ -21,13 +21,25 @@ lean_lib ConduitTests where
 lean_exe conduit_tests where
   root := `ConduitTests.Main
 
--- FFI: Build C code with pthread
+-- Benchmark harness: `lake exe conduit_bench`
+lean_exe conduit_bench where
+  root := `ConduitBench.Main
+
+-- FFI: Build C code with pthread.
+-- Set CONDUIT_FFI_TELEMETRY=1 in the environment to compile in the latency
+-- histograms and USDT probes (see Conduit.Telemetry); default builds carry
+-- no instrumentation overhead.
 target conduit_ffi_o pkg : FilePath := do
   let oFile := pkg.buildDir / "native" / "conduit_ffi.o"
   let srcJob ← inputTextFile <| pkg.dir / "native" / "src" / "conduit_ffi.c"
   let leanIncludeDir ← getLeanIncludeDir
   let weakArgs := #["-I", leanIncludeDir.toString]
-  buildO oFile srcJob weakArgs #["-fPIC", "-O2", "-pthread"] "cc" getLeanTrace
+  let telemetryArgs :=
+    if (← IO.getEnv "CONDUIT_FFI_TELEMETRY").isSome then
+      #["-DCONDUIT_FFI_TELEMETRY"]
+    else
+      #[]
+  buildO oFile srcJob weakArgs (#["-fPIC", "-O2", "-pthread"] ++ telemetryArgs) "cc" getLeanTrace
 
 extern_lib conduit_native pkg := do
   let name := nameToStaticLib "conduit_native"
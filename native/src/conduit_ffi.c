@@ -12,6 +12,10 @@
 #include <time.h>
 #include <errno.h>
 #include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 /* ============================================================================
  * Allocation Tracking (for testing finalizers and memory leaks)
@@ -20,6 +24,148 @@
 static _Atomic int64_t g_channel_alloc_count = 0;
 static _Atomic int64_t g_channel_free_count = 0;
 
+/* ============================================================================
+ * Per-Channel Statistics (opt-in via Channel.enableStats)
+ *
+ * All counters use relaxed atomics so the hot path pays only uncontended
+ * increments; the pointer is NULL until stats are enabled, so channels
+ * that never opt in pay a single branch.
+ * ============================================================================ */
+
+typedef struct {
+    _Atomic uint64_t sends;        /* Values successfully sent */
+    _Atomic uint64_t recvs;        /* Values successfully received */
+    _Atomic uint64_t send_blocks;  /* Send operations that had to park */
+    _Atomic uint64_t recv_blocks;  /* Recv operations that had to park */
+    _Atomic uint64_t blocked_ns;   /* Cumulative nanoseconds spent parked */
+    _Atomic uint64_t high_water;   /* Maximum observed buffer depth */
+} conduit_channel_stats_t;
+
+static uint64_t stats_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static inline void stats_count(_Atomic uint64_t *counter, uint64_t n) {
+    atomic_fetch_add_explicit(counter, n, memory_order_relaxed);
+}
+
+static void stats_high_water(conduit_channel_stats_t *st, uint64_t depth) {
+    uint64_t hw = atomic_load_explicit(&st->high_water, memory_order_relaxed);
+    while (depth > hw &&
+           !atomic_compare_exchange_weak_explicit(&st->high_water, &hw, depth,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+    }
+}
+
+/* ============================================================================
+ * Operation Latency Telemetry (compile-time opt-in)
+ *
+ * Built only when CONDUIT_FFI_TELEMETRY is defined (see the conduit_ffi_o
+ * target in lakefile.lean); without it every hook compiles to nothing and
+ * Conduit.Telemetry.snapshot reports zeros. With it, send/recv/select-wait
+ * latencies are accumulated into log2-bucketed histograms in per-thread
+ * blocks - each counter has a single writer, so the hot path is relaxed
+ * increments with no shared cache line - and merged across threads when a
+ * snapshot is read. Recording still requires the process-wide runtime
+ * toggle (Conduit.Telemetry.setEnabled), so an instrumented build idles at
+ * one relaxed load per operation until someone is actually looking.
+ *
+ * The same build flag enables USDT probe points (conduit:channel_send,
+ * conduit:channel_recv, conduit:channel_close) when <sys/sdt.h> is
+ * available, so perf/bpftrace can attach in production without another
+ * rebuild.
+ * ============================================================================ */
+
+#define TELEM_OP_SEND        0
+#define TELEM_OP_RECV        1
+#define TELEM_OP_SELECT_WAIT 2
+#define TELEM_OP_COUNT       3
+#define TELEM_BUCKETS        64
+
+#ifdef CONDUIT_FFI_TELEMETRY
+
+#if defined(__has_include)
+#  if __has_include(<sys/sdt.h>)
+#    include <sys/sdt.h>
+#    define CONDUIT_PROBE1(name, a1) DTRACE_PROBE1(conduit, name, a1)
+#  endif
+#endif
+
+static _Atomic bool g_telemetry_enabled = false;
+
+/* One histogram block per thread that ever records. Blocks live for the
+ * process lifetime (thread churn is bounded by .dedicated task count), so
+ * the reader can walk the list without coordinating with writers. */
+typedef struct conduit_telem_block {
+    _Atomic uint64_t buckets[TELEM_OP_COUNT][TELEM_BUCKETS];
+    _Atomic uint64_t count[TELEM_OP_COUNT];
+    _Atomic uint64_t total_ns[TELEM_OP_COUNT];
+    _Atomic uint64_t max_ns[TELEM_OP_COUNT];
+    struct conduit_telem_block *next;
+} conduit_telem_block_t;
+
+static pthread_mutex_t g_telem_mutex = PTHREAD_MUTEX_INITIALIZER;
+static conduit_telem_block_t *g_telem_blocks = NULL;
+static _Thread_local conduit_telem_block_t *t_telem_block = NULL;
+
+static conduit_telem_block_t *telem_block(void) {
+    if (!t_telem_block) {
+        conduit_telem_block_t *b =
+            (conduit_telem_block_t *)calloc(1, sizeof(conduit_telem_block_t));
+        if (!b) {
+            return NULL; /* Drop the sample; telemetry must never fail an op */
+        }
+        pthread_mutex_lock(&g_telem_mutex);
+        b->next = g_telem_blocks;
+        g_telem_blocks = b;
+        pthread_mutex_unlock(&g_telem_mutex);
+        t_telem_block = b;
+    }
+    return t_telem_block;
+}
+
+/* Bucket i holds durations in [2^i, 2^(i+1)) nanoseconds. */
+static inline int telem_bucket(uint64_t ns) {
+    return ns == 0 ? 0 : 63 - __builtin_clzll(ns);
+}
+
+static void telem_record(int op, uint64_t start_ns) {
+    conduit_telem_block_t *b = telem_block();
+    if (!b) {
+        return;
+    }
+    uint64_t dur = stats_now_ns() - start_ns;
+    stats_count(&b->buckets[op][telem_bucket(dur)], 1);
+    stats_count(&b->count[op], 1);
+    stats_count(&b->total_ns[op], dur);
+    /* Single writer per block: a plain load/store race-free max */
+    if (dur > atomic_load_explicit(&b->max_ns[op], memory_order_relaxed)) {
+        atomic_store_explicit(&b->max_ns[op], dur, memory_order_relaxed);
+    }
+}
+
+/* Start a latency sample: zero when telemetry is off so TELEM_END can
+ * skip recording without re-reading the toggle. */
+#define TELEM_START(var) \
+    uint64_t var = atomic_load_explicit(&g_telemetry_enabled, memory_order_relaxed) \
+        ? stats_now_ns() : 0
+#define TELEM_END(op, var) \
+    do { if (var) telem_record(op, var); } while (0)
+
+#else /* !CONDUIT_FFI_TELEMETRY */
+
+#define TELEM_START(var) do { } while (0)
+#define TELEM_END(op, var) do { } while (0)
+
+#endif /* CONDUIT_FFI_TELEMETRY */
+
+#ifndef CONDUIT_PROBE1
+#define CONDUIT_PROBE1(name, a1) do { } while (0)
+#endif
+
 /* ============================================================================
  * Select Waiter Structure (forward declaration)
  * ============================================================================ */
@@ -29,24 +175,74 @@ typedef struct conduit_select_waiter {
     pthread_mutex_t *mutex;       /* Points to waiter's mutex */
     volatile bool notified;       /* Set true when any channel signals */
     struct conduit_select_waiter *next;  /* Linked list for channel's waiter list */
+    lean_object *cases;           /* Borrowed case array; valid while registered */
+    struct conduit_channel * volatile ready_ch;  /* Direct handoff: channel that woke us */
+
+    /* Fixed-arity selects (conduit_select2_rr and friends) carry their
+     * cases inline instead of through a Lean array; cases is NULL then. */
+    struct conduit_channel *fixed_ch[3];
+    bool fixed_send[3];
+    uint8_t fixed_n;
 } conduit_select_waiter_t;
 
+/* What kind of readiness a channel event produced. Used to wake only one
+ * eligible select waiter instead of the whole list (thundering herd). */
+typedef enum {
+    SELECT_EVENT_RECV_READY,  /* Data arrived: wake a waiter with a recv case */
+    SELECT_EVENT_SEND_READY,  /* Space freed: wake a waiter with a send case */
+    SELECT_EVENT_ANY          /* Close/cancel: wake every waiter */
+} conduit_select_event_t;
+
 /* ============================================================================
  * Channel Structure
  * ============================================================================ */
 
+/* Cell of the lock-free MPMC ring (Vyukov bounded queue).
+ * seq tracks which lap the cell is on: seq == pos means free for the
+ * enqueuer at position pos, seq == pos + 1 means occupied for the
+ * dequeuer at position pos. */
+typedef struct {
+    _Atomic size_t seq;
+    lean_object *value;
+} conduit_mpmc_cell_t;
+
+/* Cache-line-padded index for the SPSC ring. Each side owns one index and
+ * keeps a cached copy of the peer's, so the hot path touches the shared
+ * cache line only when the cached view says the ring looks full/empty. */
 typedef struct {
+    _Atomic size_t pos;           /* Owner-published position */
+    size_t cache;                 /* Owner's cached copy of the peer position */
+    char _pad[64 - sizeof(_Atomic size_t) - sizeof(size_t)];
+} conduit_spsc_index_t;
+
+typedef struct conduit_channel {
     pthread_mutex_t mutex;
     pthread_cond_t not_empty;     /* Signal when data available or closed */
     pthread_cond_t not_full;      /* Signal when space available or closed */
 
-    /* Circular buffer for buffered channels */
+    /* Circular buffer for buffered channels. The declared capacity is only
+     * a semantic bound for blocking: the ring itself is allocated lazily on
+     * first send and grown geometrically up to capacity, shrinking back
+     * after sustained low occupancy, so resident memory tracks actual
+     * depth rather than worst-case provisioning. */
     lean_object **buffer;
-    size_t capacity;              /* 0 = unbuffered */
+    size_t capacity;              /* 0 = unbuffered; semantic bound */
+    size_t buf_cap;               /* Allocated ring slots (<= capacity) */
+    size_t low_streak;            /* Consecutive low-occupancy receives */
     size_t head;                  /* Read position */
     size_t tail;                  /* Write position */
     size_t count;                 /* Current item count */
 
+    /* Priority lane (Channel.newPrioritized): a small second ring drained
+     * ahead of the main one by recv/tryRecv/select readiness, so control
+     * messages never queue behind bulk data. FIFO within the lane; close
+     * drains both lanes. prio_cap is 0 for ordinary channels. */
+    lean_object **prio_buffer;
+    size_t prio_cap;
+    size_t prio_head;
+    size_t prio_tail;
+    size_t prio_count;
+
     /* For unbuffered channels: pending value for handoff */
     lean_object *pending_value;
     bool pending_ready;           /* True if a sender is waiting */
@@ -55,8 +251,68 @@ typedef struct {
     /* Track waiting threads for unbuffered send readiness */
     size_t waiting_receivers;     /* Receivers blocked waiting for data */
 
-    /* Select waiter list (protected by channel mutex) */
-    conduit_select_waiter_t *select_waiters;  /* Head of linked list */
+    /* Adaptive waiting (Channel.setWaitMode): how the unbuffered handoff
+     * waits in send/recv behave. Spinners watch lock-free mirrors of the
+     * handoff flags (published under the mutex) before parking. */
+    uint8_t wait_mode;            /* WAIT_MODE_* */
+    _Atomic bool a_pending_ready;
+    _Atomic bool a_pending_taken;
+
+    /* Select waiter list. Mutated only under the channel mutex; the head
+     * is atomic so fast-path producers can check for waiters without the
+     * lock (see lf_wake). The next links stay plain: they are only read
+     * under the mutex. */
+    _Atomic(conduit_select_waiter_t *) select_waiters;
+
+    /* Global live-channel registry (protected by g_channels_mutex) */
+    struct conduit_channel *reg_prev;
+    struct conduit_channel *reg_next;
+
+    /* Opt-in statistics; NULL until Channel.enableStats */
+    conduit_channel_stats_t *stats;
+
+    /* Lock-free MPMC ring (Channel.newLockFree). NULL for mutex-based
+     * channels; when set, trySend/tryRecv bypass the mutex entirely and
+     * the condvars above serve only as a parking fallback. */
+    conduit_mpmc_cell_t *lf_cells;
+    _Atomic size_t lf_head;            /* Dequeue position */
+    _Atomic size_t lf_tail;            /* Enqueue position */
+    _Atomic bool lf_closed;            /* Mirror of closed, readable without the mutex */
+    _Atomic size_t lf_waiting_senders;   /* Senders parked on not_full */
+    _Atomic size_t lf_waiting_receivers; /* Receivers parked on not_empty */
+
+    /* Wait-free SPSC ring (Channel.newSpsc). NULL otherwise. Shares the
+     * lf_* closed flag, waiting counts, and parking fallback. */
+    lean_object **spsc_cells;
+    conduit_spsc_index_t spsc_head;    /* Consumer-owned */
+    conduit_spsc_index_t spsc_tail;    /* Producer-owned */
+
+    /* Unbounded chunked queue (Channel.newUnbounded): a linked list of
+     * fixed-size segments allocated on demand, so memory tracks actual
+     * queue depth and send never blocks. count above tracks queued values. */
+    struct conduit_segment *seg_head;  /* Dequeue end */
+    struct conduit_segment *seg_tail;  /* Enqueue end */
+    size_t seg_head_pos;               /* Next read slot in seg_head */
+    size_t seg_tail_pos;               /* Next write slot in seg_tail */
+    bool unbounded;
+
+    /* Values evicted or discarded by overwrite-on-full sends
+     * (lossy broadcast subscribers). Relaxed: it is a monitoring counter. */
+    _Atomic uint64_t dropped;
+
+    /* Mirror of count, published after every mutation so Channel.len is a
+     * single relaxed load instead of a mutex round-trip. It may lag the
+     * authoritative count by a moment; it is a monitoring value. */
+    _Atomic size_t depth;
+
+    /* High-water callback (Channel.onHighWater). Edge-triggered: fires once
+     * when depth crosses hw_threshold from below, re-arms when depth drops
+     * back under it. The handler runs on the sending thread, outside the
+     * channel lock. hw_handler is written once and retained until the
+     * channel is finalized. */
+    lean_object *_Atomic hw_handler;   /* NULL until registered */
+    size_t hw_threshold;
+    _Atomic bool hw_armed;
 
     bool closed;
 } conduit_channel_t;
@@ -64,585 +320,1412 @@ typedef struct {
 /* Forward declarations for select waiter helpers */
 static void select_register_waiter(conduit_channel_t *ch, conduit_select_waiter_t *w);
 static void select_unregister_waiter(conduit_channel_t *ch, conduit_select_waiter_t *w);
-static void select_notify_waiters(conduit_channel_t *ch);
+static void select_notify_waiters(conduit_channel_t *ch, conduit_select_event_t event);
 
 /* ============================================================================
  * Interruptible Wait Helper
  *
- * Uses a short timeout (10ms) instead of blocking forever, allowing
- * the loop to re-check conditions periodically. This makes operations
- * interruptible by Lean's IO.cancel mechanism.
+ * Blocked operations sleep indefinitely on their condvar and wake only on
+ * actual channel events - no periodic polling. Task cancellation is
+ * observed by checking the current task's cancel flag whenever the thread
+ * wakes; conduit_wake_blocked (Conduit.cancel on the Lean side) kicks
+ * every live channel's condvars so a freshly-canceled waiter wakes
+ * immediately instead of sleeping until the next channel event.
  * ============================================================================ */
 
-#define POLL_INTERVAL_NS 10000000  /* 10ms in nanoseconds */
+/* From the Lean runtime (IO.checkCanceled); not declared in lean.h */
+extern lean_obj_res lean_io_check_canceled(lean_obj_arg world);
+
+/* Check whether the task running on this thread has been canceled. */
+static bool current_task_canceled(void) {
+    lean_object *res = lean_io_check_canceled(lean_box(0));
+    bool canceled = false;
+    if (lean_io_result_is_ok(res)) {
+        canceled = lean_unbox(lean_io_result_get_value(res)) != 0;
+    }
+    lean_dec(res);
+    return canceled;
+}
 
+/* Wait for a channel event. Returns ECANCELED if the current task has been
+ * canceled (checked before sleeping and again on wakeup), 0 otherwise.
+ * Callers bail out of the blocking operation on ECANCELED. */
 static int cond_wait_interruptible(pthread_cond_t *cond, pthread_mutex_t *mutex) {
-    struct timespec deadline;
-    clock_gettime(CLOCK_REALTIME, &deadline);
-    deadline.tv_nsec += POLL_INTERVAL_NS;
-    if (deadline.tv_nsec >= 1000000000) {
-        deadline.tv_sec++;
-        deadline.tv_nsec -= 1000000000;
+    if (current_task_canceled()) {
+        return ECANCELED;
     }
-    return pthread_cond_timedwait(cond, mutex, &deadline);
+    pthread_cond_wait(cond, mutex);
+    return current_task_canceled() ? ECANCELED : 0;
 }
 
 /* ============================================================================
- * External Class Registration
+ * Adaptive Spin-Then-Park Waiting
+ *
+ * A rendezvous on an unbuffered channel costs two condvar sleep/wake
+ * round-trips, which puts a multi-microsecond floor on request/reply
+ * latency even when the peer is already running on another core. In
+ * hybrid or spin mode the handoff waits in send/recv first spin with a
+ * pause hint, watching lock-free mirrors of the handoff flags, and only
+ * park on the condvar once the spin budget is exhausted:
+ *   WAIT_MODE_PARK   - park immediately (default; frees the core)
+ *   WAIT_MODE_HYBRID - spin SPIN_BUDGET pause iterations, then park
+ *   WAIT_MODE_SPIN   - spin until the flag flips or the task is canceled
+ * Spinning burns a core while waiting: hybrid and spin are for pinned
+ * threads on latency-critical paths, not general use.
  * ============================================================================ */
 
-static lean_external_class *g_channel_class = NULL;
-
-static void conduit_channel_finalizer(void *ptr) {
-    conduit_channel_t *ch = (conduit_channel_t *)ptr;
-    if (ch) {
-        atomic_fetch_add(&g_channel_free_count, 1);
-        pthread_mutex_lock(&ch->mutex);
+#define WAIT_MODE_PARK   0
+#define WAIT_MODE_HYBRID 1
+#define WAIT_MODE_SPIN   2
+
+/* Pause iterations a hybrid waiter spends before parking: roughly the
+ * cost of one condvar round-trip, so a prompt peer wins the fast path
+ * and a slow one costs little extra. */
+#define SPIN_BUDGET 2048
+
+static inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
 
-        /* Release any values still in the buffer */
-        if (ch->buffer) {
-            while (ch->count > 0) {
-                lean_dec(ch->buffer[ch->head]);
-                ch->head = (ch->head + 1) % ch->capacity;
-                ch->count--;
-            }
-            free(ch->buffer);
+/* Publish the lock-free mirrors of the handoff flags. Called (with the
+ * mutex held) after every mutation of pending_ready/pending_taken. */
+static inline void handoff_publish(struct conduit_channel *ch);
+
+/* Spin watching *flag until it reads `want` or the channel closes.
+ * Called with the mutex held; drops it while spinning and re-acquires it
+ * before returning, so the caller's wait loop re-checks the
+ * authoritative state either way. Returns true if the spin observed the
+ * wanted state (or close), false if the caller should park. */
+static bool handoff_spin(conduit_channel_t *ch, const _Atomic bool *flag, bool want) {
+    if (ch->wait_mode == WAIT_MODE_PARK) {
+        return false;
+    }
+    bool forever = ch->wait_mode == WAIT_MODE_SPIN;
+    pthread_mutex_unlock(&ch->mutex);
+    bool hit = false;
+    for (size_t i = 0; forever || i < SPIN_BUDGET; i++) {
+        if (atomic_load_explicit(flag, memory_order_acquire) == want ||
+            atomic_load_explicit(&ch->lf_closed, memory_order_acquire)) {
+            hit = true;
+            break;
         }
-
-        /* Release pending value if any */
-        if (ch->pending_value) {
-            lean_dec(ch->pending_value);
+        /* A pure spinner must still observe task cancellation; checking
+         * periodically keeps the hot loop to loads and pauses. */
+        if (forever && (i & 0x3FFF) == 0x3FFF && current_task_canceled()) {
+            break;
         }
-
-        pthread_mutex_unlock(&ch->mutex);
-
-        pthread_mutex_destroy(&ch->mutex);
-        pthread_cond_destroy(&ch->not_empty);
-        pthread_cond_destroy(&ch->not_full);
-        free(ch);
+        cpu_relax();
     }
+    pthread_mutex_lock(&ch->mutex);
+    return hit;
 }
 
-static void conduit_channel_foreach(void *ptr, b_lean_obj_arg f) {
-    /* No nested Lean objects to traverse */
-    (void)ptr;
-    (void)f;
+/* ============================================================================
+ * Monotonic Deadlines
+ *
+ * All timed waits run against CLOCK_MONOTONIC so a realtime clock step
+ * (NTP) cannot fire a timeout early or stretch it. On Linux the condvars
+ * themselves are attached to the monotonic clock; macOS lacks
+ * pthread_condattr_setclock, so deadlines are converted to relative waits
+ * serviced by pthread_cond_timedwait_relative_np, which is equally immune
+ * to realtime steps.
+ * ============================================================================ */
+
+#ifndef __APPLE__
+static pthread_condattr_t g_monotonic_condattr;
+static pthread_once_t g_monotonic_condattr_once = PTHREAD_ONCE_INIT;
+
+static void monotonic_condattr_setup(void) {
+    pthread_condattr_init(&g_monotonic_condattr);
+    pthread_condattr_setclock(&g_monotonic_condattr, CLOCK_MONOTONIC);
+}
+#endif
+
+/* Initialize a condvar whose timed waits use the monotonic clock. */
+static int cond_init_monotonic(pthread_cond_t *cond) {
+#ifdef __APPLE__
+    return pthread_cond_init(cond, NULL);
+#else
+    pthread_once(&g_monotonic_condattr_once, monotonic_condattr_setup);
+    return pthread_cond_init(cond, &g_monotonic_condattr);
+#endif
 }
 
-static inline lean_obj_res conduit_channel_box(conduit_channel_t *ch) {
-    if (g_channel_class == NULL) {
-        g_channel_class = lean_register_external_class(
-            conduit_channel_finalizer,
-            conduit_channel_foreach
-        );
+/* Absolute monotonic deadline timeout_ms from now. */
+static void deadline_after_ms(struct timespec *deadline, size_t timeout_ms) {
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += timeout_ms / 1000;
+    deadline->tv_nsec += (timeout_ms % 1000) * 1000000;
+    if (deadline->tv_nsec >= 1000000000) {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000;
     }
-    return lean_alloc_external(g_channel_class, ch);
 }
 
-static inline conduit_channel_t *conduit_channel_unbox(b_lean_obj_arg obj) {
-    return (conduit_channel_t *)lean_get_external_data(obj);
+/* Timed wait against a monotonic deadline. Returns 0 or ETIMEDOUT. */
+static int cond_timedwait_deadline(pthread_cond_t *cond, pthread_mutex_t *mutex,
+                                   const struct timespec *deadline) {
+#ifdef __APPLE__
+    struct timespec now, rel;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    rel.tv_sec = deadline->tv_sec - now.tv_sec;
+    rel.tv_nsec = deadline->tv_nsec - now.tv_nsec;
+    if (rel.tv_nsec < 0) {
+        rel.tv_sec--;
+        rel.tv_nsec += 1000000000;
+    }
+    if (rel.tv_sec < 0) {
+        return ETIMEDOUT;
+    }
+    return pthread_cond_timedwait_relative_np(cond, mutex, &rel);
+#else
+    return pthread_cond_timedwait(cond, mutex, deadline);
+#endif
 }
 
 /* ============================================================================
- * Helper: Create IO error result
+ * Live Channel Registry
+ *
+ * All live channels are linked into a global list so conduit_wake_blocked
+ * can broadcast their condvars. Lock order is always g_channels_mutex
+ * before any channel mutex; the finalizer removes the channel from the
+ * registry before touching its own lock.
  * ============================================================================ */
 
-static lean_obj_res mk_io_error(const char *msg) {
-    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(msg)));
+static pthread_mutex_t g_channels_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct conduit_channel *g_channels = NULL;
+
+static void channel_registry_add(conduit_channel_t *ch) {
+    pthread_mutex_lock(&g_channels_mutex);
+    ch->reg_prev = NULL;
+    ch->reg_next = g_channels;
+    if (g_channels) {
+        g_channels->reg_prev = ch;
+    }
+    g_channels = ch;
+    pthread_mutex_unlock(&g_channels_mutex);
+}
+
+static void channel_registry_remove(conduit_channel_t *ch) {
+    pthread_mutex_lock(&g_channels_mutex);
+    if (ch->reg_prev) {
+        ch->reg_prev->reg_next = ch->reg_next;
+    } else {
+        g_channels = ch->reg_next;
+    }
+    if (ch->reg_next) {
+        ch->reg_next->reg_prev = ch->reg_prev;
+    }
+    pthread_mutex_unlock(&g_channels_mutex);
 }
 
 /* ============================================================================
- * conduit_channel_new : Type → IO (Channel α)
+ * Channel Pool
  *
- * Create an unbuffered channel (capacity 0).
- * Note: Type parameter is erased at runtime, not passed to FFI.
+ * Combinators and hub subscriptions create and destroy channels at high
+ * rates, and a cold conduit_channel_new_buffered is a malloc + calloc + one
+ * mutex init + two cond inits, all torn down again by the finalizer.
+ * Retired mutex-based channels are instead parked on a small free list,
+ * bucketed by capacity class, with their sync primitives kept initialized,
+ * so steady-state channel creation is a pop-and-reset. Lock-free and SPSC
+ * channels carry extra ring allocations and are not pooled.
  * ============================================================================ */
 
-LEAN_EXPORT lean_obj_res conduit_channel_new(lean_obj_arg world) {
-    (void)world;
+#define CHANNEL_POOL_BUCKETS 16    /* Bucket 0 = unbuffered, then by log2 of capacity */
+#define CHANNEL_POOL_PER_BUCKET 32
 
-    conduit_channel_t *ch = (conduit_channel_t *)malloc(sizeof(conduit_channel_t));
-    if (!ch) {
-        return mk_io_error("Failed to allocate channel");
+static pthread_mutex_t g_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static conduit_channel_t *g_pool[CHANNEL_POOL_BUCKETS];  /* Linked via reg_next */
+static size_t g_pool_len[CHANNEL_POOL_BUCKETS];
+static _Atomic int64_t g_channel_pool_hits = 0;
+static _Atomic int64_t g_channel_cold_allocs = 0;
+
+static size_t channel_pool_bucket(size_t capacity) {
+    size_t b = 0;
+    while (capacity > 0 && b < CHANNEL_POOL_BUCKETS - 1) {
+        capacity >>= 1;
+        b++;
     }
+    return b;
+}
 
-    if (pthread_mutex_init(&ch->mutex, NULL) != 0) {
-        free(ch);
-        return mk_io_error("Failed to initialize mutex");
+/* Take a retired channel for the requested capacity, or NULL if the bucket
+ * is empty. The buffer is reused when the capacity matches exactly;
+ * otherwise it is reallocated - the sync primitives, the expensive part,
+ * are reused either way. */
+static conduit_channel_t *channel_pool_acquire(size_t capacity) {
+    size_t bucket = channel_pool_bucket(capacity);
+
+    pthread_mutex_lock(&g_pool_mutex);
+    conduit_channel_t *ch = g_pool[bucket];
+    if (ch) {
+        g_pool[bucket] = ch->reg_next;
+        g_pool_len[bucket]--;
     }
+    pthread_mutex_unlock(&g_pool_mutex);
 
-    if (pthread_cond_init(&ch->not_empty, NULL) != 0) {
-        pthread_mutex_destroy(&ch->mutex);
-        free(ch);
-        return mk_io_error("Failed to initialize condition variable");
+    if (!ch) {
+        return NULL;
     }
 
-    if (pthread_cond_init(&ch->not_full, NULL) != 0) {
-        pthread_cond_destroy(&ch->not_empty);
-        pthread_mutex_destroy(&ch->mutex);
-        free(ch);
-        return mk_io_error("Failed to initialize condition variable");
+    if (ch->capacity != capacity) {
+        /* The ring is lazily allocated, so just drop the stale one */
+        free(ch->buffer);
+        ch->buffer = NULL;
+        ch->buf_cap = 0;
+        ch->capacity = capacity;
+    } else if (ch->buffer) {
+        memset(ch->buffer, 0, ch->buf_cap * sizeof(lean_object *));
     }
 
-    ch->buffer = NULL;
-    ch->capacity = 0;
+    return ch;
+}
+
+/* Park a retired channel on the free list, keeping its buffer attached and
+ * its primitives initialized. Returns false when the bucket is full; the
+ * caller then destroys the channel the cold way. Called from the finalizer
+ * after all values have been released. */
+static bool channel_pool_release(conduit_channel_t *ch) {
+    size_t bucket = channel_pool_bucket(ch->capacity);
+
+    pthread_mutex_lock(&g_pool_mutex);
+    if (g_pool_len[bucket] >= CHANNEL_POOL_PER_BUCKET) {
+        pthread_mutex_unlock(&g_pool_mutex);
+        return false;
+    }
+    ch->reg_next = g_pool[bucket];
+    g_pool[bucket] = ch;
+    g_pool_len[bucket]++;
+    pthread_mutex_unlock(&g_pool_mutex);
+    return true;
+}
+
+/* Reset the mutable state of a fresh or recycled channel. The caller has
+ * already set buffer and capacity. */
+static void channel_reset(conduit_channel_t *ch) {
     ch->head = 0;
     ch->tail = 0;
     ch->count = 0;
+    ch->low_streak = 0;
+    ch->prio_buffer = NULL;
+    ch->prio_cap = 0;
+    ch->prio_head = 0;
+    ch->prio_tail = 0;
+    ch->prio_count = 0;
     ch->pending_value = NULL;
     ch->pending_ready = false;
     ch->pending_taken = false;
     ch->waiting_receivers = 0;
-    ch->select_waiters = NULL;
+    ch->wait_mode = WAIT_MODE_PARK;
+    atomic_store_explicit(&ch->a_pending_ready, false, memory_order_relaxed);
+    atomic_store_explicit(&ch->a_pending_taken, false, memory_order_relaxed);
+    atomic_store_explicit(&ch->select_waiters,
+                          (conduit_select_waiter_t *)NULL,
+                          memory_order_relaxed);
+    ch->stats = NULL;
+    ch->lf_cells = NULL;
+    atomic_store_explicit(&ch->lf_head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ch->lf_tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&ch->lf_closed, false, memory_order_relaxed);
+    atomic_store_explicit(&ch->lf_waiting_senders, 0, memory_order_relaxed);
+    atomic_store_explicit(&ch->lf_waiting_receivers, 0, memory_order_relaxed);
+    ch->spsc_cells = NULL;
+    atomic_store_explicit(&ch->spsc_head.pos, 0, memory_order_relaxed);
+    ch->spsc_head.cache = 0;
+    atomic_store_explicit(&ch->spsc_tail.pos, 0, memory_order_relaxed);
+    ch->spsc_tail.cache = 0;
+    ch->seg_head = NULL;
+    ch->seg_tail = NULL;
+    ch->seg_head_pos = 0;
+    ch->seg_tail_pos = 0;
+    ch->unbounded = false;
+    atomic_store_explicit(&ch->dropped, 0, memory_order_relaxed);
+    atomic_store_explicit(&ch->depth, 0, memory_order_relaxed);
+    atomic_store_explicit(&ch->hw_handler, NULL, memory_order_relaxed);
+    ch->hw_threshold = 0;
+    atomic_store_explicit(&ch->hw_armed, false, memory_order_relaxed);
     ch->closed = false;
+}
 
-    atomic_fetch_add(&g_channel_alloc_count, 1);
-    return lean_io_result_mk_ok(conduit_channel_box(ch));
+/* Total queued values across the main ring and the priority lane. */
+static inline size_t queued_total(conduit_channel_t *ch) {
+    return ch->count + ch->prio_count;
+}
+
+static inline void handoff_publish(struct conduit_channel *ch) {
+    atomic_store_explicit(&ch->a_pending_ready, ch->pending_ready, memory_order_release);
+    atomic_store_explicit(&ch->a_pending_taken, ch->pending_taken, memory_order_release);
+}
+
+/* Publish the queued total to the lock-free depth mirror. Called (with the
+ * mutex held) after every mutation of either lane's count so Channel.len
+ * never needs the lock. Also keeps the high-water edge trigger armed
+ * whenever depth sits under the threshold; it disarms only when the
+ * handler fires. */
+static inline void depth_publish(conduit_channel_t *ch) {
+    size_t total = queued_total(ch);
+    atomic_store_explicit(&ch->depth, total, memory_order_relaxed);
+    if (atomic_load_explicit(&ch->hw_handler, memory_order_relaxed) != NULL
+        && total < ch->hw_threshold) {
+        atomic_store_explicit(&ch->hw_armed, true, memory_order_release);
+    }
 }
 
 /* ============================================================================
- * conduit_channel_new_buffered : Type → Nat → IO (Channel α)
+ * Lazy Ring Allocation
  *
- * Create a buffered channel with given capacity.
- * Note: Type parameter is erased at runtime, not passed to FFI.
+ * A channel provisioned at capacity 16384 for burst absorption usually
+ * sits near-empty; eagerly callocing the full pointer array pins memory
+ * that is never touched. The ring instead starts unallocated, grows
+ * geometrically on demand up to the declared capacity, and shrinks back
+ * after a sustained run of low-occupancy receives. All helpers are called
+ * with the channel mutex held.
  * ============================================================================ */
 
-LEAN_EXPORT lean_obj_res conduit_channel_new_buffered(
-    b_lean_obj_arg capacity_obj,
-    lean_obj_arg world
-) {
-    size_t capacity = lean_usize_of_nat(capacity_obj);
+#define CHANNEL_BUF_MIN 8
+#define CHANNEL_SHRINK_STREAK 128
 
-    /* Capacity 0 is equivalent to unbuffered */
-    if (capacity == 0) {
-        return conduit_channel_new(world);
+/* Re-allocate the ring at new_cap slots (>= count), linearizing the live
+ * values to the front. Returns false if the allocation failed, leaving
+ * the old ring in place. */
+static bool buffer_rebuild(conduit_channel_t *ch, size_t new_cap) {
+    lean_object **nb = (lean_object **)calloc(new_cap, sizeof(lean_object *));
+    if (!nb) {
+        return false;
+    }
+    for (size_t i = 0; i < ch->count; i++) {
+        nb[i] = ch->buffer[(ch->head + i) % ch->buf_cap];
     }
+    free(ch->buffer);
+    ch->buffer = nb;
+    ch->buf_cap = new_cap;
+    ch->head = 0;
+    ch->tail = ch->count % new_cap;
+    return true;
+}
 
-    conduit_channel_t *ch = (conduit_channel_t *)malloc(sizeof(conduit_channel_t));
-    if (!ch) {
-        return mk_io_error("Failed to allocate channel");
+/* Ensure the ring has room for `needed` values in total (clamped to the
+ * declared capacity). Grows geometrically so n sends cost O(log n)
+ * reallocations. Returns false on allocation failure. */
+static bool buffer_reserve(conduit_channel_t *ch, size_t needed) {
+    if (needed > ch->capacity) {
+        needed = ch->capacity;
     }
+    if (needed <= ch->buf_cap) {
+        return true;
+    }
+    size_t new_cap = ch->buf_cap ? ch->buf_cap : CHANNEL_BUF_MIN;
+    while (new_cap < needed) {
+        new_cap *= 2;
+    }
+    if (new_cap > ch->capacity) {
+        new_cap = ch->capacity;
+    }
+    return buffer_rebuild(ch, new_cap);
+}
 
-    ch->buffer = (lean_object **)calloc(capacity, sizeof(lean_object *));
-    if (!ch->buffer) {
-        free(ch);
-        return mk_io_error("Failed to allocate channel buffer");
+/* Shrink the ring by half once occupancy has stayed at or below a quarter
+ * of the allocation for CHANNEL_SHRINK_STREAK consecutive receives, so a
+ * burst does not pin its peak footprint forever. */
+static void buffer_maybe_shrink(conduit_channel_t *ch) {
+    if (ch->buf_cap <= CHANNEL_BUF_MIN) {
+        return;
+    }
+    if (ch->count > ch->buf_cap / 4) {
+        ch->low_streak = 0;
+        return;
     }
+    if (++ch->low_streak < CHANNEL_SHRINK_STREAK) {
+        return;
+    }
+    ch->low_streak = 0;
+    size_t new_cap = ch->buf_cap / 2;
+    if (new_cap < CHANNEL_BUF_MIN) {
+        new_cap = CHANNEL_BUF_MIN;
+    }
+    buffer_rebuild(ch, new_cap); /* Failure just keeps the larger ring */
+}
 
-    if (pthread_mutex_init(&ch->mutex, NULL) != 0) {
-        free(ch->buffer);
-        free(ch);
-        return mk_io_error("Failed to initialize mutex");
+/* Take the oldest queued value, priority lane first (called with the
+ * mutex held, queued_total > 0; not for unbounded or fast channels). */
+static lean_object *channel_pop_locked(conduit_channel_t *ch) {
+    if (ch->prio_count > 0) {
+        lean_object *value = ch->prio_buffer[ch->prio_head];
+        ch->prio_buffer[ch->prio_head] = NULL;
+        ch->prio_head = (ch->prio_head + 1) % ch->prio_cap;
+        ch->prio_count--;
+        depth_publish(ch);
+        return value;
     }
+    lean_object *value = ch->buffer[ch->head];
+    ch->buffer[ch->head] = NULL;
+    ch->head = (ch->head + 1) % ch->buf_cap;
+    ch->count--;
+    depth_publish(ch);
+    return value;
+}
 
-    if (pthread_cond_init(&ch->not_empty, NULL) != 0) {
-        pthread_mutex_destroy(&ch->mutex);
-        free(ch->buffer);
-        free(ch);
-        return mk_io_error("Failed to initialize condition variable");
+/* ============================================================================
+ * Unbounded Queue Segments
+ *
+ * Channel.newUnbounded queues values through a linked list of fixed-size
+ * segments instead of one big preallocated ring: segments are allocated
+ * only as the queue grows and recycled through a small global cache, so
+ * an idle channel costs one segment instead of worst-case provisioning.
+ * ============================================================================ */
+
+#define CONDUIT_SEGMENT_SLOTS 256
+#define SEGMENT_CACHE_MAX 16
+
+typedef struct conduit_segment {
+    struct conduit_segment *next;
+    lean_object *slots[CONDUIT_SEGMENT_SLOTS];
+} conduit_segment_t;
+
+static pthread_mutex_t g_segment_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+static conduit_segment_t *g_segment_cache = NULL;
+static size_t g_segment_cache_len = 0;
+
+static conduit_segment_t *segment_acquire(void) {
+    pthread_mutex_lock(&g_segment_cache_mutex);
+    conduit_segment_t *seg = g_segment_cache;
+    if (seg) {
+        g_segment_cache = seg->next;
+        g_segment_cache_len--;
     }
+    pthread_mutex_unlock(&g_segment_cache_mutex);
 
-    if (pthread_cond_init(&ch->not_full, NULL) != 0) {
-        pthread_cond_destroy(&ch->not_empty);
-        pthread_mutex_destroy(&ch->mutex);
-        free(ch->buffer);
-        free(ch);
-        return mk_io_error("Failed to initialize condition variable");
+    if (!seg) {
+        seg = (conduit_segment_t *)malloc(sizeof(conduit_segment_t));
     }
+    if (seg) {
+        seg->next = NULL;
+    }
+    return seg;
+}
 
-    ch->capacity = capacity;
-    ch->head = 0;
-    ch->tail = 0;
-    ch->count = 0;
-    ch->pending_value = NULL;
-    ch->pending_ready = false;
-    ch->pending_taken = false;
-    ch->waiting_receivers = 0;
-    ch->select_waiters = NULL;
-    ch->closed = false;
+static void segment_release(conduit_segment_t *seg) {
+    pthread_mutex_lock(&g_segment_cache_mutex);
+    if (g_segment_cache_len < SEGMENT_CACHE_MAX) {
+        seg->next = g_segment_cache;
+        g_segment_cache = seg;
+        g_segment_cache_len++;
+        seg = NULL;
+    }
+    pthread_mutex_unlock(&g_segment_cache_mutex);
+    free(seg);  /* Cache full (or NULL if parked) */
+}
 
-    atomic_fetch_add(&g_channel_alloc_count, 1);
-    return lean_io_result_mk_ok(conduit_channel_box(ch));
+/* Append a value to an unbounded channel (called with mutex held).
+ * Returns false only if a segment allocation failed. */
+static bool unbounded_push(conduit_channel_t *ch, lean_object *value) {
+    if (!ch->seg_tail || ch->seg_tail_pos == CONDUIT_SEGMENT_SLOTS) {
+        conduit_segment_t *seg = segment_acquire();
+        if (!seg) {
+            return false;
+        }
+        if (ch->seg_tail) {
+            ch->seg_tail->next = seg;
+        } else {
+            ch->seg_head = seg;
+            ch->seg_head_pos = 0;
+        }
+        ch->seg_tail = seg;
+        ch->seg_tail_pos = 0;
+    }
+    ch->seg_tail->slots[ch->seg_tail_pos++] = value;
+    ch->count++;
+    depth_publish(ch);
+    return true;
+}
+
+/* Take the oldest value from an unbounded channel (called with mutex held,
+ * count > 0). Exhausted segments go back to the segment cache. */
+static lean_object *unbounded_pop(conduit_channel_t *ch) {
+    lean_object *value = ch->seg_head->slots[ch->seg_head_pos++];
+    ch->count--;
+    depth_publish(ch);
+
+    if (ch->count == 0 && ch->seg_head == ch->seg_tail) {
+        /* Queue drained: rewind the resident segment instead of cycling it */
+        ch->seg_head_pos = 0;
+        ch->seg_tail_pos = 0;
+    } else if (ch->seg_head_pos == CONDUIT_SEGMENT_SLOTS) {
+        conduit_segment_t *old = ch->seg_head;
+        ch->seg_head = old->next;
+        ch->seg_head_pos = 0;
+        segment_release(old);
+    }
+    return value;
 }
 
 /* ============================================================================
- * conduit_channel_send : Channel α → α → IO Bool
+ * Lock-Free MPMC Ring (Vyukov bounded queue)
  *
- * Blocking send. Returns false if channel is closed.
+ * Fast path for channels created with Channel.newLockFree: producers and
+ * consumers race on atomic sequence numbers only. The channel mutex and
+ * condvars are used solely for parking when the ring is full/empty, and
+ * waiter counts let the fast path skip the wakeup entirely when nobody
+ * is parked.
  * ============================================================================ */
 
-LEAN_EXPORT lean_obj_res conduit_channel_send(
-    b_lean_obj_arg ch_obj,
-    lean_obj_arg value,
-    lean_obj_arg world
-) {
-    (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
-
-    pthread_mutex_lock(&ch->mutex);
+/* Try to enqueue. Returns 0 = ok, 1 = full, 2 = closed. Never locks. */
+static int lf_try_send(conduit_channel_t *ch, lean_object *value) {
+    if (atomic_load_explicit(&ch->lf_closed, memory_order_acquire)) {
+        return 2;
+    }
+    size_t pos = atomic_load_explicit(&ch->lf_tail, memory_order_relaxed);
+    for (;;) {
+        conduit_mpmc_cell_t *cell = &ch->lf_cells[pos % ch->capacity];
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &ch->lf_tail, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                cell->value = value;
+                atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+                return 0;
+            }
+        } else if (dif < 0) {
+            return 1; /* full */
+        } else {
+            pos = atomic_load_explicit(&ch->lf_tail, memory_order_relaxed);
+        }
+    }
+}
 
-    /* Check if closed */
-    if (ch->closed) {
-        pthread_mutex_unlock(&ch->mutex);
-        lean_dec(value);
-        return lean_io_result_mk_ok(lean_box(0)); /* false */
+/* Try to dequeue. Returns 0 = ok (*out set), 1 = empty. Never locks. */
+static int lf_try_recv(conduit_channel_t *ch, lean_object **out) {
+    size_t pos = atomic_load_explicit(&ch->lf_head, memory_order_relaxed);
+    for (;;) {
+        conduit_mpmc_cell_t *cell = &ch->lf_cells[pos % ch->capacity];
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &ch->lf_head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                *out = cell->value;
+                cell->value = NULL;
+                atomic_store_explicit(&cell->seq, pos + ch->capacity, memory_order_release);
+                return 0;
+            }
+        } else if (dif < 0) {
+            return 1; /* empty */
+        } else {
+            pos = atomic_load_explicit(&ch->lf_head, memory_order_relaxed);
+        }
     }
+}
 
-    if (ch->capacity == 0) {
-        /* Unbuffered channel: wait for receiver */
-        while (ch->pending_ready && !ch->closed) {
-            cond_wait_interruptible(&ch->not_full, &ch->mutex);
+/* Try to enqueue on the SPSC ring. Producer side only.
+ * Returns 0 = ok, 1 = full, 2 = closed. Wait-free. */
+static int spsc_try_send(conduit_channel_t *ch, lean_object *value) {
+    if (atomic_load_explicit(&ch->lf_closed, memory_order_acquire)) {
+        return 2;
+    }
+    size_t tail = atomic_load_explicit(&ch->spsc_tail.pos, memory_order_relaxed);
+    if (tail - ch->spsc_tail.cache >= ch->capacity) {
+        ch->spsc_tail.cache = atomic_load_explicit(&ch->spsc_head.pos, memory_order_acquire);
+        if (tail - ch->spsc_tail.cache >= ch->capacity) {
+            return 1; /* full */
         }
+    }
+    ch->spsc_cells[tail % ch->capacity] = value;
+    atomic_store_explicit(&ch->spsc_tail.pos, tail + 1, memory_order_release);
+    return 0;
+}
 
-        if (ch->closed) {
-            pthread_mutex_unlock(&ch->mutex);
-            lean_dec(value);
-            return lean_io_result_mk_ok(lean_box(0)); /* false */
+/* Try to dequeue from the SPSC ring. Consumer side only.
+ * Returns 0 = ok (*out set), 1 = empty. Wait-free. */
+static int spsc_try_recv(conduit_channel_t *ch, lean_object **out) {
+    size_t head = atomic_load_explicit(&ch->spsc_head.pos, memory_order_relaxed);
+    if (head >= ch->spsc_head.cache) {
+        ch->spsc_head.cache = atomic_load_explicit(&ch->spsc_tail.pos, memory_order_acquire);
+        if (head >= ch->spsc_head.cache) {
+            return 1; /* empty */
         }
+    }
+    *out = ch->spsc_cells[head % ch->capacity];
+    ch->spsc_cells[head % ch->capacity] = NULL;
+    atomic_store_explicit(&ch->spsc_head.pos, head + 1, memory_order_release);
+    return 0;
+}
 
-        ch->pending_value = value;
-        ch->pending_ready = true;
-        ch->pending_taken = false;
+static size_t lf_depth(conduit_channel_t *ch);
+static void hw_rearm(conduit_channel_t *ch);
 
-        /* Signal that a value is available */
-        pthread_cond_signal(&ch->not_empty);
-        select_notify_waiters(ch);
+/* True for channels whose non-blocking fast path bypasses the mutex
+ * (lock-free MPMC and SPSC rings). */
+static inline bool channel_is_fast(conduit_channel_t *ch) {
+    return ch->lf_cells != NULL || ch->spsc_cells != NULL;
+}
 
-        /* Wait for receiver to take it or channel to close */
-        while (!ch->pending_taken && !ch->closed) {
-            cond_wait_interruptible(&ch->not_full, &ch->mutex);
+/* Dispatch the non-blocking operation to whichever fast ring this
+ * channel carries. Same result codes as lf_try_send/lf_try_recv. */
+static int fast_try_send(conduit_channel_t *ch, lean_object *value) {
+    int rc = ch->spsc_cells ? spsc_try_send(ch, value) : lf_try_send(ch, value);
+    if (rc == 0 && ch->stats) {
+        stats_count(&ch->stats->sends, 1);
+        stats_high_water(ch->stats, lf_depth(ch));
+    }
+    return rc;
+}
+
+static int fast_try_recv(conduit_channel_t *ch, lean_object **out) {
+    int rc = ch->spsc_cells ? spsc_try_recv(ch, out) : lf_try_recv(ch, out);
+    if (rc == 0) {
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, 1);
         }
+        hw_rearm(ch);
+    }
+    return rc;
+}
 
-        bool success = ch->pending_taken;
-        ch->pending_value = NULL;
-        ch->pending_ready = false;
-        ch->pending_taken = false;
+/* Approximate number of items in the fast ring. */
+static size_t lf_depth(conduit_channel_t *ch) {
+    size_t tail, head;
+    if (ch->spsc_cells) {
+        tail = atomic_load_explicit(&ch->spsc_tail.pos, memory_order_acquire);
+        head = atomic_load_explicit(&ch->spsc_head.pos, memory_order_acquire);
+    } else {
+        tail = atomic_load_explicit(&ch->lf_tail, memory_order_acquire);
+        head = atomic_load_explicit(&ch->lf_head, memory_order_acquire);
+    }
+    return tail > head ? tail - head : 0;
+}
 
-        pthread_mutex_unlock(&ch->mutex);
+/* Wake parked threads / selectors after a successful fast-path operation.
+ * Only touches the mutex when someone might actually be waiting. */
+static void lf_wake(conduit_channel_t *ch, bool wake_receivers) {
+    /* The fence orders the ring enqueue/dequeue before these waiter
+     * checks, pairing with the fence in select_register_waiter (and the
+     * RMW in the park paths): either this side sees the waiter, or the
+     * waiter's readiness re-check sees the ring update. */
+    atomic_thread_fence(memory_order_seq_cst);
+    bool parked = wake_receivers
+        ? atomic_load_explicit(&ch->lf_waiting_receivers, memory_order_acquire) > 0
+        : atomic_load_explicit(&ch->lf_waiting_senders, memory_order_acquire) > 0;
+    if (!parked &&
+        atomic_load_explicit(&ch->select_waiters, memory_order_seq_cst) == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&ch->mutex);
+    if (wake_receivers) {
+        pthread_cond_broadcast(&ch->not_empty);
+    } else {
+        pthread_cond_broadcast(&ch->not_full);
+    }
+    select_notify_waiters(ch, wake_receivers ? SELECT_EVENT_RECV_READY : SELECT_EVENT_SEND_READY);
+    pthread_mutex_unlock(&ch->mutex);
+}
 
-        if (!success) {
-            /* Channel closed before receiver took value */
-            lean_dec(value);
-        }
+/* ============================================================================
+ * Depth Mirror and High-Water Notification
+ *
+ * Channel.len and Channel.isClosed read lock-free mirrors so a monitoring
+ * loop sampling hundreds of channels adds no contention to the channels
+ * it watches. Channel.onHighWater turns polling into notification: the
+ * send path fires a registered handler once when depth crosses a
+ * threshold, and the trigger re-arms when depth drops back under it.
+ * ============================================================================ */
 
-        return lean_io_result_mk_ok(lean_box(success ? 1 : 0));
-    } else {
-        /* Buffered channel: wait for space */
-        while (ch->count >= ch->capacity && !ch->closed) {
-            cond_wait_interruptible(&ch->not_full, &ch->mutex);
+/* Approximate depth without taking the mutex. */
+static inline size_t channel_depth(conduit_channel_t *ch) {
+    if (channel_is_fast(ch)) {
+        return lf_depth(ch);
+    }
+    return atomic_load_explicit(&ch->depth, memory_order_relaxed);
+}
+
+/* Fire the high-water handler if depth has crossed the threshold from
+ * below. Call with no channel locks held: the handler is arbitrary Lean
+ * code and may itself touch the channel. */
+static void hw_check_after_send(conduit_channel_t *ch) {
+    lean_object *handler =
+        atomic_load_explicit(&ch->hw_handler, memory_order_acquire);
+    if (handler == NULL) {
+        return;
+    }
+    if (channel_depth(ch) < ch->hw_threshold) {
+        return;
+    }
+    if (!atomic_exchange_explicit(&ch->hw_armed, false, memory_order_acq_rel)) {
+        return; /* Already fired for this crossing */
+    }
+    lean_inc(handler);
+    lean_object *r = lean_apply_1(handler, lean_io_mk_world());
+    lean_dec(r);
+}
+
+/* Re-arm the edge trigger once depth has dropped back under threshold.
+ * Mutex-based channels re-arm via depth_publish; this handles fast rings. */
+static void hw_rearm(conduit_channel_t *ch) {
+    if (atomic_load_explicit(&ch->hw_handler, memory_order_relaxed) == NULL) {
+        return;
+    }
+    if (channel_depth(ch) < ch->hw_threshold) {
+        atomic_store_explicit(&ch->hw_armed, true, memory_order_release);
+    }
+}
+
+/* Blocking enqueue with optional deadline.
+ * Returns 0 = ok, 1 = timeout, 2 = closed. Takes ownership of value on ok. */
+static int lf_send_block(conduit_channel_t *ch, lean_object *value,
+                         const struct timespec *deadline) {
+    for (;;) {
+        int rc = fast_try_send(ch, value);
+        if (rc != 1) {
+            if (rc == 0) lf_wake(ch, true);
+            return rc;
         }
 
-        if (ch->closed) {
+        /* Ring full: park on not_full. The waiting count is raised while
+         * holding the mutex and the ring re-checked before sleeping, so a
+         * consumer's wakeup cannot be missed. */
+        uint64_t st_t0 = 0;
+        if (ch->stats) {
+            stats_count(&ch->stats->send_blocks, 1);
+            st_t0 = stats_now_ns();
+        }
+        pthread_mutex_lock(&ch->mutex);
+        atomic_fetch_add(&ch->lf_waiting_senders, 1);
+        rc = fast_try_send(ch, value);
+        if (rc != 1) {
+            atomic_fetch_sub(&ch->lf_waiting_senders, 1);
             pthread_mutex_unlock(&ch->mutex);
-            lean_dec(value);
-            return lean_io_result_mk_ok(lean_box(0)); /* false */
+            if (rc == 0) lf_wake(ch, true);
+            return rc;
         }
+        int wrc;
+        if (deadline) {
+            wrc = cond_timedwait_deadline(&ch->not_full, &ch->mutex, deadline);
+        } else {
+            wrc = cond_wait_interruptible(&ch->not_full, &ch->mutex);
+        }
+        atomic_fetch_sub(&ch->lf_waiting_senders, 1);
+        pthread_mutex_unlock(&ch->mutex);
+        if (ch->stats && st_t0) {
+            stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+        }
+        if (wrc == ETIMEDOUT) {
+            return 1; /* timeout */
+        }
+        if (wrc == ECANCELED) {
+            return 2; /* canceled - behave as closed */
+        }
+    }
+}
 
-        /* Add to buffer */
-        ch->buffer[ch->tail] = value;
-        ch->tail = (ch->tail + 1) % ch->capacity;
-        ch->count++;
-
-        /* Signal that data is available */
-        pthread_cond_signal(&ch->not_empty);
-        select_notify_waiters(ch);
+/* Blocking dequeue with optional deadline.
+ * Returns 0 = ok (*out set), 1 = timeout, 2 = closed and drained. */
+static int lf_recv_block(conduit_channel_t *ch, lean_object **out,
+                         const struct timespec *deadline) {
+    for (;;) {
+        if (fast_try_recv(ch, out) == 0) {
+            lf_wake(ch, false);
+            return 0;
+        }
+        if (atomic_load_explicit(&ch->lf_closed, memory_order_acquire)) {
+            /* Re-check: a value may have been enqueued before close won. */
+            if (fast_try_recv(ch, out) == 0) {
+                lf_wake(ch, false);
+                return 0;
+            }
+            return 2;
+        }
 
+        uint64_t st_t0 = 0;
+        if (ch->stats) {
+            stats_count(&ch->stats->recv_blocks, 1);
+            st_t0 = stats_now_ns();
+        }
+        pthread_mutex_lock(&ch->mutex);
+        atomic_fetch_add(&ch->lf_waiting_receivers, 1);
+        if (fast_try_recv(ch, out) == 0) {
+            atomic_fetch_sub(&ch->lf_waiting_receivers, 1);
+            pthread_mutex_unlock(&ch->mutex);
+            lf_wake(ch, false);
+            return 0;
+        }
+        int wrc = 0;
+        if (!atomic_load_explicit(&ch->lf_closed, memory_order_acquire)) {
+            if (deadline) {
+                wrc = cond_timedwait_deadline(&ch->not_empty, &ch->mutex, deadline);
+            } else {
+                wrc = cond_wait_interruptible(&ch->not_empty, &ch->mutex);
+            }
+        }
+        atomic_fetch_sub(&ch->lf_waiting_receivers, 1);
         pthread_mutex_unlock(&ch->mutex);
-        return lean_io_result_mk_ok(lean_box(1)); /* true */
+        if (ch->stats && st_t0) {
+            stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+        }
+        if (wrc == ETIMEDOUT) {
+            return 1; /* timeout */
+        }
+        if (wrc == ECANCELED) {
+            return 2; /* canceled - behave as closed and drained */
+        }
     }
 }
 
 /* ============================================================================
- * conduit_channel_recv : Channel α → IO (Option α)
- *
- * Blocking receive. Returns none if channel is closed and empty.
+ * External Class Registration
  * ============================================================================ */
 
-LEAN_EXPORT lean_obj_res conduit_channel_recv(
-    b_lean_obj_arg ch_obj,
-    lean_obj_arg world
-) {
-    (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+static lean_external_class *g_channel_class = NULL;
 
-    pthread_mutex_lock(&ch->mutex);
+static void conduit_channel_finalizer(void *ptr) {
+    conduit_channel_t *ch = (conduit_channel_t *)ptr;
+    if (ch) {
+        atomic_fetch_add(&g_channel_free_count, 1);
+        channel_registry_remove(ch);
+        pthread_mutex_lock(&ch->mutex);
 
-    if (ch->capacity == 0) {
-        /* Unbuffered channel: wait for sender */
-        while (!ch->pending_ready && !ch->closed) {
-            ch->waiting_receivers++;
-            cond_wait_interruptible(&ch->not_empty, &ch->mutex);
-            ch->waiting_receivers--;
+        /* Release any values still in the buffer */
+        if (ch->buffer) {
+            while (ch->count > 0) {
+                lean_dec(ch->buffer[ch->head]);
+                ch->head = (ch->head + 1) % ch->buf_cap;
+                ch->count--;
+            }
         }
 
-        if (ch->pending_ready && !ch->pending_taken) {
-            /* Take the value from sender */
-            lean_object *value = ch->pending_value;
-            ch->pending_taken = true;
-            ch->pending_ready = false;  /* Clear to prevent duplicate reads */
+        /* Release any values still in the priority lane */
+        if (ch->prio_buffer) {
+            while (ch->prio_count > 0) {
+                lean_dec(ch->prio_buffer[ch->prio_head]);
+                ch->prio_head = (ch->prio_head + 1) % ch->prio_cap;
+                ch->prio_count--;
+            }
+            free(ch->prio_buffer);
+            ch->prio_buffer = NULL;
+            ch->prio_cap = 0;
+        }
 
-            /* Signal sender that we took it */
-            pthread_cond_signal(&ch->not_full);
-            select_notify_waiters(ch);
+        /* Release any values still in a fast ring */
+        if (channel_is_fast(ch)) {
+            lean_object *value;
+            while (fast_try_recv(ch, &value) == 0) {
+                lean_dec(value);
+            }
+        }
 
-            pthread_mutex_unlock(&ch->mutex);
+        /* Release values and segments of an unbounded channel */
+        if (ch->unbounded) {
+            while (ch->count > 0) {
+                lean_dec(unbounded_pop(ch));
+            }
+            conduit_segment_t *seg = ch->seg_head;
+            while (seg) {
+                conduit_segment_t *next = seg->next;
+                segment_release(seg);
+                seg = next;
+            }
+            ch->seg_head = NULL;
+            ch->seg_tail = NULL;
+        }
 
-            /* Return Some value */
-            lean_object *some = lean_alloc_ctor(1, 1, 0);
-            lean_ctor_set(some, 0, value);
-            return lean_io_result_mk_ok(some);
+        /* Release pending value if any */
+        if (ch->pending_value) {
+            lean_dec(ch->pending_value);
+            ch->pending_value = NULL;
         }
 
-        /* Channel closed, no pending value */
         pthread_mutex_unlock(&ch->mutex);
-        return lean_io_result_mk_ok(lean_box(0)); /* none */
-    } else {
-        /* Buffered channel: wait for data */
-        while (ch->count == 0 && !ch->closed) {
-            cond_wait_interruptible(&ch->not_empty, &ch->mutex);
-        }
 
-        if (ch->count == 0) {
-            /* Channel closed and empty */
-            pthread_mutex_unlock(&ch->mutex);
-            return lean_io_result_mk_ok(lean_box(0)); /* none */
+        lean_object *handler =
+            atomic_load_explicit(&ch->hw_handler, memory_order_relaxed);
+        if (handler) {
+            lean_dec(handler);
+            atomic_store_explicit(&ch->hw_handler, NULL, memory_order_relaxed);
         }
 
-        /* Take from buffer */
-        lean_object *value = ch->buffer[ch->head];
-        ch->buffer[ch->head] = NULL;
-        ch->head = (ch->head + 1) % ch->capacity;
-        ch->count--;
+        free(ch->stats);
+        ch->stats = NULL;
 
-        /* Signal that space is available */
-        pthread_cond_signal(&ch->not_full);
-        select_notify_waiters(ch);
+        /* Recycle mutex-based channels through the pool when there is room,
+         * keeping buffer and sync primitives alive for the next creation. */
+        if (!channel_is_fast(ch) && channel_pool_release(ch)) {
+            return;
+        }
 
-        pthread_mutex_unlock(&ch->mutex);
+        pthread_mutex_destroy(&ch->mutex);
+        pthread_cond_destroy(&ch->not_empty);
+        pthread_cond_destroy(&ch->not_full);
+        free(ch->buffer);
+        free(ch->lf_cells);
+        free(ch->spsc_cells);
+        free(ch);
+    }
+}
 
-        /* Return Some value */
-        lean_object *some = lean_alloc_ctor(1, 1, 0);
-        lean_ctor_set(some, 0, value);
-        return lean_io_result_mk_ok(some);
+static void conduit_channel_foreach(void *ptr, b_lean_obj_arg f) {
+    /* No nested Lean objects to traverse */
+    (void)ptr;
+    (void)f;
+}
+
+static inline lean_obj_res conduit_channel_box(conduit_channel_t *ch) {
+    if (g_channel_class == NULL) {
+        g_channel_class = lean_register_external_class(
+            conduit_channel_finalizer,
+            conduit_channel_foreach
+        );
     }
+    return lean_alloc_external(g_channel_class, ch);
+}
+
+static inline conduit_channel_t *conduit_channel_unbox(b_lean_obj_arg obj) {
+    return (conduit_channel_t *)lean_get_external_data(obj);
 }
 
 /* ============================================================================
- * conduit_channel_try_send : Channel α → α → IO UInt8
- *
- * Non-blocking send. Returns 0=ok, 1=would block, 2=closed.
+ * Helper: Create IO error result
  * ============================================================================ */
 
-LEAN_EXPORT lean_obj_res conduit_channel_try_send(
-    b_lean_obj_arg ch_obj,
-    lean_obj_arg value,
-    lean_obj_arg world
-) {
-    (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
-
-    pthread_mutex_lock(&ch->mutex);
-
-    if (ch->closed) {
-        pthread_mutex_unlock(&ch->mutex);
-        lean_dec(value);
-        return lean_io_result_mk_ok(lean_box(2)); /* closed */
-    }
+static lean_obj_res mk_io_error(const char *msg) {
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string(msg)));
+}
 
-    if (ch->capacity == 0) {
-        /* Unbuffered: can send if receiver is waiting and no sender in progress */
-        if (ch->waiting_receivers > 0 && !ch->pending_ready) {
-            /* Perform the handoff */
-            ch->pending_value = value;
-            ch->pending_ready = true;
-            ch->pending_taken = false;
+/* ============================================================================
+ * conduit_channel_new : Type → IO (Channel α)
+ *
+ * Create an unbuffered channel (capacity 0).
+ * Note: Type parameter is erased at runtime, not passed to FFI.
+ * ============================================================================ */
 
-            /* Wake one waiting receiver */
-            pthread_cond_signal(&ch->not_empty);
-            select_notify_waiters(ch);
+LEAN_EXPORT lean_obj_res conduit_channel_new(lean_obj_arg world) {
+    (void)world;
 
-            /* Wait for receiver to take it (they should be immediate) */
-            while (!ch->pending_taken && !ch->closed) {
-                cond_wait_interruptible(&ch->not_full, &ch->mutex);
-            }
+    conduit_channel_t *ch = channel_pool_acquire(0);
+    if (ch) {
+        atomic_fetch_add(&g_channel_pool_hits, 1);
+    } else {
+        ch = (conduit_channel_t *)malloc(sizeof(conduit_channel_t));
+        if (!ch) {
+            return mk_io_error("Failed to allocate channel");
+        }
 
-            bool success = ch->pending_taken;
-            ch->pending_value = NULL;
-            ch->pending_ready = false;
-            ch->pending_taken = false;
+        if (pthread_mutex_init(&ch->mutex, NULL) != 0) {
+            free(ch);
+            return mk_io_error("Failed to initialize mutex");
+        }
 
-            pthread_mutex_unlock(&ch->mutex);
-            if (!success) lean_dec(value);
-            return lean_io_result_mk_ok(lean_box(success ? 0 : 2)); /* ok or closed */
+        if (cond_init_monotonic(&ch->not_empty) != 0) {
+            pthread_mutex_destroy(&ch->mutex);
+            free(ch);
+            return mk_io_error("Failed to initialize condition variable");
         }
-        /* No receiver waiting - would block */
-        pthread_mutex_unlock(&ch->mutex);
-        lean_dec(value);
-        return lean_io_result_mk_ok(lean_box(1)); /* would block */
-    } else {
-        /* Buffered: check if space available */
-        if (ch->count >= ch->capacity) {
-            pthread_mutex_unlock(&ch->mutex);
-            lean_dec(value);
-            return lean_io_result_mk_ok(lean_box(1)); /* would block */
+
+        if (cond_init_monotonic(&ch->not_full) != 0) {
+            pthread_cond_destroy(&ch->not_empty);
+            pthread_mutex_destroy(&ch->mutex);
+            free(ch);
+            return mk_io_error("Failed to initialize condition variable");
         }
 
-        /* Add to buffer */
-        ch->buffer[ch->tail] = value;
-        ch->tail = (ch->tail + 1) % ch->capacity;
-        ch->count++;
+        ch->buffer = NULL;
+        ch->buf_cap = 0;
+        ch->capacity = 0;
+        atomic_fetch_add(&g_channel_cold_allocs, 1);
+    }
 
-        pthread_cond_signal(&ch->not_empty);
-        select_notify_waiters(ch);
+    channel_reset(ch);
 
-        pthread_mutex_unlock(&ch->mutex);
-        return lean_io_result_mk_ok(lean_box(0)); /* ok */
-    }
+    atomic_fetch_add(&g_channel_alloc_count, 1);
+    channel_registry_add(ch);
+    return lean_io_result_mk_ok(conduit_channel_box(ch));
 }
 
 /* ============================================================================
- * conduit_channel_try_recv : Channel α → IO (TryResult α)
+ * conduit_channel_new_buffered : Type → Nat → IO (Channel α)
  *
- * Non-blocking receive. Returns TryResult: .ok value | .empty | .closed
- * We encode this as: 0 = closed, 1 = empty, 2 = ok (followed by value)
- * Actually, let's return a pair (tag, Option value) for simplicity.
+ * Create a buffered channel with given capacity.
+ * Note: Type parameter is erased at runtime, not passed to FFI.
  * ============================================================================ */
 
-LEAN_EXPORT lean_obj_res conduit_channel_try_recv(
-    b_lean_obj_arg ch_obj,
+LEAN_EXPORT lean_obj_res conduit_channel_new_buffered(
+    b_lean_obj_arg capacity_obj,
     lean_obj_arg world
 ) {
-    (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    size_t capacity = lean_usize_of_nat(capacity_obj);
 
-    pthread_mutex_lock(&ch->mutex);
+    /* Capacity 0 is equivalent to unbuffered */
+    if (capacity == 0) {
+        return conduit_channel_new(world);
+    }
 
-    if (ch->capacity == 0) {
-        /* Unbuffered: check if sender is waiting */
-        if (ch->pending_ready && !ch->pending_taken) {
-            lean_object *value = ch->pending_value;
-            ch->pending_taken = true;
-            ch->pending_ready = false;  /* Clear to prevent duplicate reads */
-            pthread_cond_signal(&ch->not_full);
-            select_notify_waiters(ch);
-            pthread_mutex_unlock(&ch->mutex);
+    conduit_channel_t *ch = channel_pool_acquire(capacity);
+    if (ch) {
+        atomic_fetch_add(&g_channel_pool_hits, 1);
+    } else {
+        ch = (conduit_channel_t *)malloc(sizeof(conduit_channel_t));
+        if (!ch) {
+            return mk_io_error("Failed to allocate channel");
+        }
 
-            /* Return .ok value (constructor 0) */
-            lean_object *result = lean_alloc_ctor(0, 1, 0);
-            lean_ctor_set(result, 0, value);
-            return lean_io_result_mk_ok(result);
+        if (pthread_mutex_init(&ch->mutex, NULL) != 0) {
+            free(ch);
+            return mk_io_error("Failed to initialize mutex");
         }
 
-        if (ch->closed) {
-            pthread_mutex_unlock(&ch->mutex);
-            /* Return .closed (constructor 2) */
-            return lean_io_result_mk_ok(lean_alloc_ctor(2, 0, 0));
+        if (cond_init_monotonic(&ch->not_empty) != 0) {
+            pthread_mutex_destroy(&ch->mutex);
+            free(ch);
+            return mk_io_error("Failed to initialize condition variable");
         }
 
-        pthread_mutex_unlock(&ch->mutex);
-        /* Return .empty (constructor 1) */
-        return lean_io_result_mk_ok(lean_alloc_ctor(1, 0, 0));
-    } else {
-        /* Buffered: check if data available */
-        if (ch->count == 0) {
-            if (ch->closed) {
-                pthread_mutex_unlock(&ch->mutex);
-                /* Return .closed (constructor 2) */
-                return lean_io_result_mk_ok(lean_alloc_ctor(2, 0, 0));
-            }
-            pthread_mutex_unlock(&ch->mutex);
-            /* Return .empty (constructor 1) */
-            return lean_io_result_mk_ok(lean_alloc_ctor(1, 0, 0));
+        if (cond_init_monotonic(&ch->not_full) != 0) {
+            pthread_cond_destroy(&ch->not_empty);
+            pthread_mutex_destroy(&ch->mutex);
+            free(ch);
+            return mk_io_error("Failed to initialize condition variable");
         }
 
-        /* Take from buffer */
-        lean_object *value = ch->buffer[ch->head];
-        ch->buffer[ch->head] = NULL;
-        ch->head = (ch->head + 1) % ch->capacity;
-        ch->count--;
+        /* The ring itself is allocated lazily on first send */
+        ch->buffer = NULL;
+        ch->buf_cap = 0;
+        ch->capacity = capacity;
+        atomic_fetch_add(&g_channel_cold_allocs, 1);
+    }
 
-        pthread_cond_signal(&ch->not_full);
-        select_notify_waiters(ch);
+    channel_reset(ch);
 
-        pthread_mutex_unlock(&ch->mutex);
+    atomic_fetch_add(&g_channel_alloc_count, 1);
+    channel_registry_add(ch);
+    return lean_io_result_mk_ok(conduit_channel_box(ch));
+}
 
-        /* Return .ok value (constructor 0) */
-        lean_object *result = lean_alloc_ctor(0, 1, 0);
-        lean_ctor_set(result, 0, value);
-        return lean_io_result_mk_ok(result);
+/* ============================================================================
+ * conduit_channel_new_unbounded : Type → IO (Channel α)
+ *
+ * Create an unbounded channel: send never blocks, values queue through
+ * on-demand segments. Capacity reports 0; len reports queued values.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_new_unbounded(lean_obj_arg world) {
+    lean_object *result = conduit_channel_new(world);
+    if (!lean_io_result_is_ok(result)) {
+        return result;
     }
+    conduit_channel_t *ch = conduit_channel_unbox(lean_io_result_get_value(result));
+    ch->unbounded = true;
+    return result;
 }
 
 /* ============================================================================
- * conduit_channel_send_timeout : Channel α → α → Nat → IO UInt8
+ * conduit_channel_new_prioritized : Type → Nat → IO (Channel α)
  *
- * Blocking send with timeout. Returns 0=ok, 1=timeout, 2=closed.
+ * Create a buffered channel with an additional small high-priority lane
+ * drained first by recv/tryRecv and select readiness. Capacity (of the
+ * main lane) is clamped to at least 1.
  * ============================================================================ */
 
-LEAN_EXPORT lean_obj_res conduit_channel_send_timeout(
+#define PRIO_LANE_CAP 64
+
+LEAN_EXPORT lean_obj_res conduit_channel_new_prioritized(
+    b_lean_obj_arg capacity_obj,
+    lean_obj_arg world
+) {
+    size_t capacity = lean_usize_of_nat(capacity_obj);
+    if (capacity == 0) {
+        capacity = 1; /* Unbuffered handoff has no lanes to prioritize */
+    }
+
+    lean_object *result =
+        conduit_channel_new_buffered(lean_usize_to_nat(capacity), world);
+    if (!lean_io_result_is_ok(result)) {
+        return result;
+    }
+
+    conduit_channel_t *ch =
+        conduit_channel_unbox(lean_io_result_get_value(result));
+
+    /* Control messages are rare, so the lane is small and eager: 64
+     * pointer slots, a fixed bound that still backpressures a runaway
+     * control producer. */
+    ch->prio_buffer =
+        (lean_object **)calloc(PRIO_LANE_CAP, sizeof(lean_object *));
+    if (!ch->prio_buffer) {
+        lean_dec(result); /* drops the channel; finalizer cleans up */
+        return mk_io_error("Failed to allocate channel buffer");
+    }
+    ch->prio_cap = PRIO_LANE_CAP;
+
+    return result;
+}
+
+/* ============================================================================
+ * conduit_channel_from_array : Type → Array α → IO (Channel α)
+ *
+ * Build an already-closed buffered channel holding every element of the
+ * array, in one step. Filling through send would pay n mutex round
+ * trips, condvar signals, and select-notify walks on a channel nobody
+ * can be reading yet; here the ring is allocated at arr.size and the
+ * object pointers are copied straight in. Backs Channel.fromArray and
+ * Channel.fromList.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_from_array(
+    b_lean_obj_arg values_obj,
+    lean_obj_arg world
+) {
+    size_t n = lean_array_size(values_obj);
+
+    /* An empty source degenerates to a closed unbuffered channel, same
+     * as filling one by hand. */
+    if (n == 0) {
+        lean_object *result = conduit_channel_new(world);
+        if (!lean_io_result_is_ok(result)) {
+            return result;
+        }
+        conduit_channel_t *ch =
+            conduit_channel_unbox(lean_io_result_get_value(result));
+        ch->closed = true;
+        atomic_store_explicit(&ch->lf_closed, true, memory_order_release);
+        return result;
+    }
+
+    lean_object *result =
+        conduit_channel_new_buffered(lean_usize_to_nat(n), world);
+    if (!lean_io_result_is_ok(result)) {
+        return result;
+    }
+    conduit_channel_t *ch =
+        conduit_channel_unbox(lean_io_result_get_value(result));
+
+    /* No other thread can hold the channel yet, so the ring is filled
+     * without the mutex. Allocate exactly n slots - the channel is born
+     * full and closed, so it will only ever drain. */
+    if (!buffer_rebuild(ch, n)) {
+        lean_dec(result); /* drops the channel; finalizer cleans up */
+        return mk_io_error("Failed to allocate channel buffer");
+    }
+
+    lean_object **src = lean_array_cptr((lean_object *)values_obj);
+    memcpy(ch->buffer, src, n * sizeof(lean_object *));
+    for (size_t i = 0; i < n; i++) {
+        lean_inc(src[i]); /* The array is borrowed; the ring owns a ref */
+    }
+    ch->count = n;
+    ch->head = 0;
+    ch->tail = n % ch->buf_cap;
+    depth_publish(ch);
+
+    ch->closed = true;
+    atomic_store_explicit(&ch->lf_closed, true, memory_order_release);
+
+    return result;
+}
+
+/* ============================================================================
+ * conduit_channel_new_lock_free : Type → Nat → IO (Channel α)
+ *
+ * Create a buffered channel whose non-blocking fast path is an atomic
+ * MPMC ring (no mutex). Capacity 0 falls back to a regular unbuffered
+ * channel, which is inherently a synchronous handoff.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_new_lock_free(
+    b_lean_obj_arg capacity_obj,
+    lean_obj_arg world
+) {
+    size_t capacity = lean_usize_of_nat(capacity_obj);
+
+    if (capacity == 0) {
+        return conduit_channel_new(world);
+    }
+
+    /* Reuse the regular constructor for the mutex/condvar/select machinery,
+     * then swap the pointer ring for an MPMC cell ring. */
+    lean_object *result = conduit_channel_new_buffered(capacity_obj, world);
+    if (!lean_io_result_is_ok(result)) {
+        return result;
+    }
+
+    conduit_channel_t *ch = conduit_channel_unbox(lean_io_result_get_value(result));
+
+    conduit_mpmc_cell_t *cells =
+        (conduit_mpmc_cell_t *)calloc(capacity, sizeof(conduit_mpmc_cell_t));
+    if (!cells) {
+        lean_dec(result); /* drops the channel; finalizer cleans up */
+        return mk_io_error("Failed to allocate channel buffer");
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&cells[i].seq, i);
+        cells[i].value = NULL;
+    }
+
+    free(ch->buffer);
+    ch->buffer = NULL;
+    ch->buf_cap = 0;
+    ch->lf_cells = cells;
+
+    return result;
+}
+
+/* ============================================================================
+ * conduit_channel_new_spsc : Type → Nat → IO (Channel α)
+ *
+ * Create a buffered channel specialized for exactly one producer thread
+ * and one consumer thread: a classic cached-index SPSC ring with no mutex
+ * on the hot path, condvars only as a parking fallback. Behavior is
+ * undefined if multiple threads send or multiple threads receive
+ * concurrently. Capacity 0 falls back to a regular unbuffered channel.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_new_spsc(
+    b_lean_obj_arg capacity_obj,
+    lean_obj_arg world
+) {
+    size_t capacity = lean_usize_of_nat(capacity_obj);
+
+    if (capacity == 0) {
+        return conduit_channel_new(world);
+    }
+
+    /* Reuse the regular constructor for the mutex/condvar/select machinery,
+     * then swap the mutex-guarded ring for the SPSC cell array. */
+    lean_object *result = conduit_channel_new_buffered(capacity_obj, world);
+    if (!lean_io_result_is_ok(result)) {
+        return result;
+    }
+
+    conduit_channel_t *ch = conduit_channel_unbox(lean_io_result_get_value(result));
+
+    lean_object **cells = (lean_object **)calloc(capacity, sizeof(lean_object *));
+    if (!cells) {
+        lean_dec(result); /* drops the channel; finalizer cleans up */
+        return mk_io_error("Failed to allocate channel buffer");
+    }
+
+    free(ch->buffer);
+    ch->buffer = NULL;
+    ch->buf_cap = 0;
+    ch->spsc_cells = cells;
+
+    return result;
+}
+
+/* ============================================================================
+ * conduit_channel_send : Channel α → α → IO Bool
+ *
+ * Blocking send. Returns false if channel is closed.
+ * ============================================================================ */
+
+static lean_obj_res conduit_channel_send_impl(
     b_lean_obj_arg ch_obj,
     lean_obj_arg value,
-    size_t timeout_ms,
     lean_obj_arg world
 ) {
     (void)world;
     conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
 
+    if (channel_is_fast(ch)) {
+        int rc = lf_send_block(ch, value, NULL);
+        if (rc != 0) {
+            lean_dec(value);
+        }
+        if (rc == 0) {
+            hw_check_after_send(ch);
+        }
+        return lean_io_result_mk_ok(lean_box(rc == 0 ? 1 : 0));
+    }
+
+    if (ch->unbounded) {
+        pthread_mutex_lock(&ch->mutex);
+        if (ch->closed) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(0)); /* false */
+        }
+        if (!unbounded_push(ch, value)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("Failed to allocate channel segment");
+        }
+        if (ch->stats) {
+            stats_count(&ch->stats->sends, 1);
+            stats_high_water(ch->stats, ch->count);
+        }
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+        pthread_mutex_unlock(&ch->mutex);
+        hw_check_after_send(ch);
+        return lean_io_result_mk_ok(lean_box(1)); /* true */
+    }
+
     pthread_mutex_lock(&ch->mutex);
 
     /* Check if closed */
     if (ch->closed) {
         pthread_mutex_unlock(&ch->mutex);
         lean_dec(value);
-        return lean_io_result_mk_ok(lean_box(2)); /* closed */
-    }
-
-    /* Calculate deadline */
-    struct timespec deadline;
-    clock_gettime(CLOCK_REALTIME, &deadline);
-    deadline.tv_sec += timeout_ms / 1000;
-    deadline.tv_nsec += (timeout_ms % 1000) * 1000000;
-    if (deadline.tv_nsec >= 1000000000) {
-        deadline.tv_sec++;
-        deadline.tv_nsec -= 1000000000;
+        return lean_io_result_mk_ok(lean_box(0)); /* false */
     }
 
     if (ch->capacity == 0) {
-        /* Unbuffered channel: wait for receiver with timeout */
+        /* Unbuffered channel: wait for receiver */
+        bool st_blocked = false;
+        uint64_t st_t0 = 0;
         while (ch->pending_ready && !ch->closed) {
-            int rc = pthread_cond_timedwait(&ch->not_full, &ch->mutex, &deadline);
-            if (rc == ETIMEDOUT) {
+            if (handoff_spin(ch, &ch->a_pending_ready, false)) {
+                continue; /* re-check under the lock */
+            }
+            if (ch->stats && !st_blocked) {
+                st_blocked = true;
+                stats_count(&ch->stats->send_blocks, 1);
+                st_t0 = stats_now_ns();
+            }
+            if (cond_wait_interruptible(&ch->not_full, &ch->mutex) == ECANCELED) {
                 pthread_mutex_unlock(&ch->mutex);
                 lean_dec(value);
-                return lean_io_result_mk_ok(lean_box(1)); /* timeout */
+                return lean_io_result_mk_ok(lean_box(0)); /* false */
             }
         }
 
         if (ch->closed) {
             pthread_mutex_unlock(&ch->mutex);
             lean_dec(value);
-            return lean_io_result_mk_ok(lean_box(2)); /* closed */
+            return lean_io_result_mk_ok(lean_box(0)); /* false */
         }
 
         ch->pending_value = value;
         ch->pending_ready = true;
         ch->pending_taken = false;
+        handoff_publish(ch);
 
         /* Signal that a value is available */
         pthread_cond_signal(&ch->not_empty);
-        select_notify_waiters(ch);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
 
-        /* Wait for receiver to take it or channel to close or timeout */
+        /* Wait for receiver to take it or channel to close */
         while (!ch->pending_taken && !ch->closed) {
-            int rc = pthread_cond_timedwait(&ch->not_full, &ch->mutex, &deadline);
-            if (rc == ETIMEDOUT) {
-                /* Timeout - clean up pending state */
+            if (handoff_spin(ch, &ch->a_pending_taken, true)) {
+                continue; /* re-check under the lock */
+            }
+            if (ch->stats && !st_blocked) {
+                st_blocked = true;
+                stats_count(&ch->stats->send_blocks, 1);
+                st_t0 = stats_now_ns();
+            }
+            if (cond_wait_interruptible(&ch->not_full, &ch->mutex) == ECANCELED) {
+                /* Canceled - withdraw the pending value */
                 ch->pending_value = NULL;
                 ch->pending_ready = false;
                 ch->pending_taken = false;
+                handoff_publish(ch);
                 pthread_mutex_unlock(&ch->mutex);
                 lean_dec(value);
-                return lean_io_result_mk_ok(lean_box(1)); /* timeout */
+                return lean_io_result_mk_ok(lean_box(0)); /* false */
             }
         }
 
@@ -650,561 +1733,4652 @@ LEAN_EXPORT lean_obj_res conduit_channel_send_timeout(
         ch->pending_value = NULL;
         ch->pending_ready = false;
         ch->pending_taken = false;
+        handoff_publish(ch);
+
+        if (ch->stats) {
+            if (st_blocked) {
+                stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+            }
+            if (success) {
+                stats_count(&ch->stats->sends, 1);
+            }
+        }
+
+        pthread_mutex_unlock(&ch->mutex);
+
+        if (!success) {
+            /* Channel closed before receiver took value */
+            lean_dec(value);
+        }
+
+        return lean_io_result_mk_ok(lean_box(success ? 1 : 0));
+    } else {
+        /* Buffered channel: wait for space */
+        bool st_blocked = false;
+        uint64_t st_t0 = 0;
+        while (ch->count >= ch->capacity && !ch->closed) {
+            if (ch->stats && !st_blocked) {
+                st_blocked = true;
+                stats_count(&ch->stats->send_blocks, 1);
+                st_t0 = stats_now_ns();
+            }
+            if (cond_wait_interruptible(&ch->not_full, &ch->mutex) == ECANCELED) {
+                pthread_mutex_unlock(&ch->mutex);
+                lean_dec(value);
+                return lean_io_result_mk_ok(lean_box(0)); /* false */
+            }
+        }
+
+        if (ch->closed) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(0)); /* false */
+        }
+
+        if (!buffer_reserve(ch, ch->count + 1)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("Failed to allocate channel buffer");
+        }
+
+        /* Add to buffer */
+        ch->buffer[ch->tail] = value;
+        ch->tail = (ch->tail + 1) % ch->buf_cap;
+        ch->count++;
+        depth_publish(ch);
+
+        if (ch->stats) {
+            if (st_blocked) {
+                stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+            }
+            stats_count(&ch->stats->sends, 1);
+            stats_high_water(ch->stats, ch->count);
+        }
+
+        /* Signal that data is available */
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+
+        pthread_mutex_unlock(&ch->mutex);
+        hw_check_after_send(ch);
+        return lean_io_result_mk_ok(lean_box(1)); /* true */
+    }
+}
+
+LEAN_EXPORT lean_obj_res conduit_channel_send(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg value,
+    lean_obj_arg world
+) {
+    CONDUIT_PROBE1(channel_send, lean_get_external_data(ch_obj));
+    TELEM_START(t0);
+    lean_obj_res result = conduit_channel_send_impl(ch_obj, value, world);
+    TELEM_END(TELEM_OP_SEND, t0);
+    return result;
+}
+
+/* ============================================================================
+ * conduit_channel_send_priority : Channel α → α → IO Bool
+ *
+ * Blocking send into the priority lane: the value is received ahead of
+ * anything queued in the main ring, FIFO among priority values. Blocks
+ * while the (small) lane is full. On a channel without a priority lane
+ * this degrades to a plain send. Returns false if the channel is closed.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_send_priority(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg value,
+    lean_obj_arg world
+) {
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    if (ch->prio_cap == 0) {
+        return conduit_channel_send(ch_obj, value, world);
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    while (ch->prio_count >= ch->prio_cap && !ch->closed) {
+        if (cond_wait_interruptible(&ch->not_full, &ch->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(0)); /* false */
+        }
+    }
+
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        lean_dec(value);
+        return lean_io_result_mk_ok(lean_box(0)); /* false */
+    }
+
+    ch->prio_buffer[ch->prio_tail] = value;
+    ch->prio_tail = (ch->prio_tail + 1) % ch->prio_cap;
+    ch->prio_count++;
+    depth_publish(ch);
+
+    if (ch->stats) {
+        stats_count(&ch->stats->sends, 1);
+        stats_high_water(ch->stats, queued_total(ch));
+    }
+
+    pthread_cond_signal(&ch->not_empty);
+    select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+
+    pthread_mutex_unlock(&ch->mutex);
+    hw_check_after_send(ch);
+    return lean_io_result_mk_ok(lean_box(1)); /* true */
+}
+
+/* ============================================================================
+ * conduit_channel_recv : Channel α → IO (Option α)
+ *
+ * Blocking receive. Returns none if channel is closed and empty.
+ * ============================================================================ */
+
+static lean_obj_res conduit_channel_recv_impl(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    if (channel_is_fast(ch)) {
+        lean_object *value;
+        if (lf_recv_block(ch, &value, NULL) == 0) {
+            lean_object *some = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(some, 0, value);
+            return lean_io_result_mk_ok(some);
+        }
+        return lean_io_result_mk_ok(lean_box(0)); /* none */
+    }
+
+    if (ch->unbounded) {
+        pthread_mutex_lock(&ch->mutex);
+        bool st_blocked = false;
+        uint64_t st_t0 = 0;
+        while (ch->count == 0 && !ch->closed) {
+            if (ch->stats && !st_blocked) {
+                st_blocked = true;
+                stats_count(&ch->stats->recv_blocks, 1);
+                st_t0 = stats_now_ns();
+            }
+            if (cond_wait_interruptible(&ch->not_empty, &ch->mutex) == ECANCELED) {
+                pthread_mutex_unlock(&ch->mutex);
+                return lean_io_result_mk_ok(lean_box(0)); /* none */
+            }
+        }
+
+        if (ch->stats && st_blocked) {
+            stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+        }
+
+        if (ch->count == 0) {
+            /* Channel closed and drained */
+            pthread_mutex_unlock(&ch->mutex);
+            return lean_io_result_mk_ok(lean_box(0)); /* none */
+        }
+
+        lean_object *value = unbounded_pop(ch);
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, 1);
+        }
+        pthread_mutex_unlock(&ch->mutex);
+
+        lean_object *some = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(some, 0, value);
+        return lean_io_result_mk_ok(some);
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->capacity == 0) {
+        /* Unbuffered channel: wait for sender */
+        bool st_blocked = false;
+        uint64_t st_t0 = 0;
+        while (!ch->pending_ready && !ch->closed) {
+            if (ch->wait_mode != WAIT_MODE_PARK) {
+                /* A spinner still counts as a waiting receiver so trySend
+                 * keeps seeing the rendezvous as ready. */
+                ch->waiting_receivers++;
+                bool hit = handoff_spin(ch, &ch->a_pending_ready, true);
+                ch->waiting_receivers--;
+                if (hit) {
+                    continue; /* re-check under the lock */
+                }
+            }
+            if (ch->stats && !st_blocked) {
+                st_blocked = true;
+                stats_count(&ch->stats->recv_blocks, 1);
+                st_t0 = stats_now_ns();
+            }
+            ch->waiting_receivers++;
+            int rc = cond_wait_interruptible(&ch->not_empty, &ch->mutex);
+            ch->waiting_receivers--;
+            if (rc == ECANCELED) {
+                pthread_mutex_unlock(&ch->mutex);
+                return lean_io_result_mk_ok(lean_box(0)); /* none */
+            }
+        }
+
+        if (ch->stats && st_blocked) {
+            stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+        }
+
+        if (ch->pending_ready && !ch->pending_taken) {
+            /* Take the value from sender */
+            lean_object *value = ch->pending_value;
+            ch->pending_taken = true;
+            ch->pending_ready = false;  /* Clear to prevent duplicate reads */
+            handoff_publish(ch);
+
+            if (ch->stats) {
+                stats_count(&ch->stats->recvs, 1);
+            }
+
+            /* Signal sender that we took it */
+            pthread_cond_signal(&ch->not_full);
+            select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+
+            pthread_mutex_unlock(&ch->mutex);
+
+            /* Return Some value */
+            lean_object *some = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(some, 0, value);
+            return lean_io_result_mk_ok(some);
+        }
+
+        /* Channel closed, no pending value */
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(lean_box(0)); /* none */
+    } else {
+        /* Buffered channel: wait for data */
+        bool st_blocked = false;
+        uint64_t st_t0 = 0;
+        while (queued_total(ch) == 0 && !ch->closed) {
+            if (ch->stats && !st_blocked) {
+                st_blocked = true;
+                stats_count(&ch->stats->recv_blocks, 1);
+                st_t0 = stats_now_ns();
+            }
+            if (cond_wait_interruptible(&ch->not_empty, &ch->mutex) == ECANCELED) {
+                pthread_mutex_unlock(&ch->mutex);
+                return lean_io_result_mk_ok(lean_box(0)); /* none */
+            }
+        }
+
+        if (ch->stats && st_blocked) {
+            stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+        }
+
+        if (queued_total(ch) == 0) {
+            /* Channel closed and empty */
+            pthread_mutex_unlock(&ch->mutex);
+            return lean_io_result_mk_ok(lean_box(0)); /* none */
+        }
+
+        /* Take from buffer, priority lane first */
+        lean_object *value = channel_pop_locked(ch);
+        buffer_maybe_shrink(ch);
+
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, 1);
+        }
+
+        /* Signal that space is available */
+        pthread_cond_signal(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+
+        pthread_mutex_unlock(&ch->mutex);
+
+        /* Return Some value */
+        lean_object *some = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(some, 0, value);
+        return lean_io_result_mk_ok(some);
+    }
+}
+
+LEAN_EXPORT lean_obj_res conduit_channel_recv(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    CONDUIT_PROBE1(channel_recv, lean_get_external_data(ch_obj));
+    TELEM_START(t0);
+    lean_obj_res result = conduit_channel_recv_impl(ch_obj, world);
+    TELEM_END(TELEM_OP_RECV, t0);
+    return result;
+}
+
+/* ============================================================================
+ * conduit_channel_try_send : Channel α → α → IO UInt8
+ *
+ * Non-blocking send. Returns 0=ok, 1=would block, 2=closed.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_try_send(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg value,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    if (channel_is_fast(ch)) {
+        /* Mutex-free fast path */
+        int rc = fast_try_send(ch, value);
+        if (rc == 0) {
+            lf_wake(ch, true);
+            hw_check_after_send(ch);
+        } else {
+            lean_dec(value);
+        }
+        return lean_io_result_mk_ok(lean_box((size_t)rc));
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        lean_dec(value);
+        return lean_io_result_mk_ok(lean_box(2)); /* closed */
+    }
+
+    if (ch->unbounded) {
+        /* Unbounded: send never blocks while open */
+        if (!unbounded_push(ch, value)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("Failed to allocate channel segment");
+        }
+        if (ch->stats) {
+            stats_count(&ch->stats->sends, 1);
+            stats_high_water(ch->stats, ch->count);
+        }
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+        pthread_mutex_unlock(&ch->mutex);
+        hw_check_after_send(ch);
+        return lean_io_result_mk_ok(lean_box(0)); /* ok */
+    }
+
+    if (ch->capacity == 0) {
+        /* Unbuffered: can send if receiver is waiting and no sender in progress */
+        if (ch->waiting_receivers > 0 && !ch->pending_ready) {
+            /* Perform the handoff */
+            ch->pending_value = value;
+            ch->pending_ready = true;
+            ch->pending_taken = false;
+            handoff_publish(ch);
+
+            /* Wake one waiting receiver */
+            pthread_cond_signal(&ch->not_empty);
+            select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+
+            /* Wait for receiver to take it (they should be immediate) */
+            while (!ch->pending_taken && !ch->closed) {
+                if (cond_wait_interruptible(&ch->not_full, &ch->mutex) == ECANCELED) {
+                    /* Canceled - withdraw the pending value, report not sent */
+                    ch->pending_value = NULL;
+                    ch->pending_ready = false;
+                    ch->pending_taken = false;
+                    handoff_publish(ch);
+                    pthread_mutex_unlock(&ch->mutex);
+                    lean_dec(value);
+                    return lean_io_result_mk_ok(lean_box(1)); /* would block */
+                }
+            }
+
+            bool success = ch->pending_taken;
+            ch->pending_value = NULL;
+            ch->pending_ready = false;
+            ch->pending_taken = false;
+            handoff_publish(ch);
+
+            if (success && ch->stats) {
+                stats_count(&ch->stats->sends, 1);
+            }
+
+            pthread_mutex_unlock(&ch->mutex);
+            if (!success) lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(success ? 0 : 2)); /* ok or closed */
+        }
+        /* No receiver waiting - would block */
+        pthread_mutex_unlock(&ch->mutex);
+        lean_dec(value);
+        return lean_io_result_mk_ok(lean_box(1)); /* would block */
+    } else {
+        /* Buffered: check if space available */
+        if (ch->count >= ch->capacity) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(1)); /* would block */
+        }
+
+        if (!buffer_reserve(ch, ch->count + 1)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("Failed to allocate channel buffer");
+        }
+
+        /* Add to buffer */
+        ch->buffer[ch->tail] = value;
+        ch->tail = (ch->tail + 1) % ch->buf_cap;
+        ch->count++;
+        depth_publish(ch);
+
+        if (ch->stats) {
+            stats_count(&ch->stats->sends, 1);
+            stats_high_water(ch->stats, ch->count);
+        }
+
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+
+        pthread_mutex_unlock(&ch->mutex);
+        hw_check_after_send(ch);
+        return lean_io_result_mk_ok(lean_box(0)); /* ok */
+    }
+}
+
+/* ============================================================================
+ * conduit_channel_try_recv : Channel α → IO (TryResult α)
+ *
+ * Non-blocking receive. Returns TryResult: .ok value | .empty | .closed
+ * We encode this as: 0 = closed, 1 = empty, 2 = ok (followed by value)
+ * Actually, let's return a pair (tag, Option value) for simplicity.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_try_recv(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    if (channel_is_fast(ch)) {
+        /* Mutex-free fast path */
+        lean_object *value;
+        if (fast_try_recv(ch, &value) == 0) {
+            lf_wake(ch, false);
+            lean_object *result = lean_alloc_ctor(0, 1, 0);
+            lean_ctor_set(result, 0, value);
+            return lean_io_result_mk_ok(result);
+        }
+        if (atomic_load_explicit(&ch->lf_closed, memory_order_acquire)) {
+            /* Re-check: a value may have raced ahead of close */
+            if (fast_try_recv(ch, &value) == 0) {
+                lf_wake(ch, false);
+                lean_object *result = lean_alloc_ctor(0, 1, 0);
+                lean_ctor_set(result, 0, value);
+                return lean_io_result_mk_ok(result);
+            }
+            return lean_io_result_mk_ok(lean_alloc_ctor(2, 0, 0)); /* closed */
+        }
+        return lean_io_result_mk_ok(lean_alloc_ctor(1, 0, 0)); /* empty */
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->unbounded) {
+        if (ch->count == 0) {
+            int tag = ch->closed ? 2 : 1; /* .closed or .empty */
+            pthread_mutex_unlock(&ch->mutex);
+            return lean_io_result_mk_ok(lean_alloc_ctor(tag, 0, 0));
+        }
+
+        lean_object *value = unbounded_pop(ch);
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, 1);
+        }
+        pthread_mutex_unlock(&ch->mutex);
+
+        /* Return .ok value (constructor 0) */
+        lean_object *result = lean_alloc_ctor(0, 1, 0);
+        lean_ctor_set(result, 0, value);
+        return lean_io_result_mk_ok(result);
+    }
+
+    if (ch->capacity == 0) {
+        /* Unbuffered: check if sender is waiting */
+        if (ch->pending_ready && !ch->pending_taken) {
+            lean_object *value = ch->pending_value;
+            ch->pending_taken = true;
+            ch->pending_ready = false;  /* Clear to prevent duplicate reads */
+            handoff_publish(ch);
+            if (ch->stats) {
+                stats_count(&ch->stats->recvs, 1);
+            }
+            pthread_cond_signal(&ch->not_full);
+            select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+            pthread_mutex_unlock(&ch->mutex);
+
+            /* Return .ok value (constructor 0) */
+            lean_object *result = lean_alloc_ctor(0, 1, 0);
+            lean_ctor_set(result, 0, value);
+            return lean_io_result_mk_ok(result);
+        }
+
+        if (ch->closed) {
+            pthread_mutex_unlock(&ch->mutex);
+            /* Return .closed (constructor 2) */
+            return lean_io_result_mk_ok(lean_alloc_ctor(2, 0, 0));
+        }
+
+        pthread_mutex_unlock(&ch->mutex);
+        /* Return .empty (constructor 1) */
+        return lean_io_result_mk_ok(lean_alloc_ctor(1, 0, 0));
+    } else {
+        /* Buffered: check if data available */
+        if (queued_total(ch) == 0) {
+            if (ch->closed) {
+                pthread_mutex_unlock(&ch->mutex);
+                /* Return .closed (constructor 2) */
+                return lean_io_result_mk_ok(lean_alloc_ctor(2, 0, 0));
+            }
+            pthread_mutex_unlock(&ch->mutex);
+            /* Return .empty (constructor 1) */
+            return lean_io_result_mk_ok(lean_alloc_ctor(1, 0, 0));
+        }
+
+        /* Take from buffer, priority lane first */
+        lean_object *value = channel_pop_locked(ch);
+        buffer_maybe_shrink(ch);
+
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, 1);
+        }
+
+        pthread_cond_signal(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+
+        pthread_mutex_unlock(&ch->mutex);
+
+        /* Return .ok value (constructor 0) */
+        lean_object *result = lean_alloc_ctor(0, 1, 0);
+        lean_ctor_set(result, 0, value);
+        return lean_io_result_mk_ok(result);
+    }
+}
+
+/* ============================================================================
+ * conduit_channel_send_timeout : Channel α → α → Nat → IO UInt8
+ *
+ * Blocking send with timeout. Returns 0=ok, 1=timeout, 2=closed.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_send_timeout(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg value,
+    size_t timeout_ms,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    if (channel_is_fast(ch)) {
+        struct timespec lf_deadline;
+        deadline_after_ms(&lf_deadline, timeout_ms);
+        int rc = lf_send_block(ch, value, &lf_deadline);
+        if (rc != 0) {
+            lean_dec(value);
+        }
+        return lean_io_result_mk_ok(lean_box((size_t)rc));
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    /* Check if closed */
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        lean_dec(value);
+        return lean_io_result_mk_ok(lean_box(2)); /* closed */
+    }
+
+    if (ch->unbounded) {
+        /* Unbounded: send never blocks, so the timeout cannot trigger */
+        if (!unbounded_push(ch, value)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("Failed to allocate channel segment");
+        }
+        if (ch->stats) {
+            stats_count(&ch->stats->sends, 1);
+            stats_high_water(ch->stats, ch->count);
+        }
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(lean_box(0)); /* ok */
+    }
+
+    /* Calculate deadline */
+    struct timespec deadline;
+    deadline_after_ms(&deadline, timeout_ms);
+
+    if (ch->capacity == 0) {
+        /* Unbuffered channel: wait for receiver with timeout */
+        while (ch->pending_ready && !ch->closed) {
+            int rc = cond_timedwait_deadline(&ch->not_full, &ch->mutex, &deadline);
+            if (rc == ETIMEDOUT) {
+                pthread_mutex_unlock(&ch->mutex);
+                lean_dec(value);
+                return lean_io_result_mk_ok(lean_box(1)); /* timeout */
+            }
+        }
+
+        if (ch->closed) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(2)); /* closed */
+        }
+
+        ch->pending_value = value;
+        ch->pending_ready = true;
+        ch->pending_taken = false;
+        handoff_publish(ch);
+
+        /* Signal that a value is available */
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+
+        /* Wait for receiver to take it or channel to close or timeout */
+        while (!ch->pending_taken && !ch->closed) {
+            int rc = cond_timedwait_deadline(&ch->not_full, &ch->mutex, &deadline);
+            if (rc == ETIMEDOUT) {
+                /* Timeout - clean up pending state */
+                ch->pending_value = NULL;
+                ch->pending_ready = false;
+                ch->pending_taken = false;
+                handoff_publish(ch);
+                pthread_mutex_unlock(&ch->mutex);
+                lean_dec(value);
+                return lean_io_result_mk_ok(lean_box(1)); /* timeout */
+            }
+        }
+
+        bool success = ch->pending_taken;
+        ch->pending_value = NULL;
+        ch->pending_ready = false;
+        ch->pending_taken = false;
+        handoff_publish(ch);
+
+        pthread_mutex_unlock(&ch->mutex);
+
+        if (!success) {
+            /* Channel closed before receiver took value */
+            lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(2)); /* closed */
+        }
+
+        return lean_io_result_mk_ok(lean_box(0)); /* ok */
+    } else {
+        /* Buffered channel: wait for space with timeout */
+        while (ch->count >= ch->capacity && !ch->closed) {
+            int rc = cond_timedwait_deadline(&ch->not_full, &ch->mutex, &deadline);
+            if (rc == ETIMEDOUT) {
+                pthread_mutex_unlock(&ch->mutex);
+                lean_dec(value);
+                return lean_io_result_mk_ok(lean_box(1)); /* timeout */
+            }
+        }
+
+        if (ch->closed) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return lean_io_result_mk_ok(lean_box(2)); /* closed */
+        }
+
+        if (!buffer_reserve(ch, ch->count + 1)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("Failed to allocate channel buffer");
+        }
+
+        /* Add to buffer */
+        ch->buffer[ch->tail] = value;
+        ch->tail = (ch->tail + 1) % ch->buf_cap;
+        ch->count++;
+        depth_publish(ch);
+
+        /* Signal that data is available */
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(lean_box(0)); /* ok */
+    }
+}
+
+/* ============================================================================
+ * conduit_channel_recv_timeout : Channel α → Nat → IO (Option (Option α))
+ *
+ * Blocking receive with timeout.
+ * Returns: none = timeout, some none = closed, some (some v) = value
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_recv_timeout(
+    b_lean_obj_arg ch_obj,
+    size_t timeout_ms,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    if (channel_is_fast(ch)) {
+        struct timespec lf_deadline;
+        deadline_after_ms(&lf_deadline, timeout_ms);
+        lean_object *value;
+        int rc = lf_recv_block(ch, &value, &lf_deadline);
+        if (rc == 0) {
+            /* some (some value) */
+            lean_object *inner = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(inner, 0, value);
+            lean_object *outer = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(outer, 0, inner);
+            return lean_io_result_mk_ok(outer);
+        }
+        if (rc == 1) {
+            return lean_io_result_mk_ok(lean_box(0)); /* none (timeout) */
+        }
+        /* some none (closed) */
+        lean_object *outer = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(outer, 0, lean_box(0));
+        return lean_io_result_mk_ok(outer);
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    /* Calculate deadline */
+    struct timespec deadline;
+    deadline_after_ms(&deadline, timeout_ms);
+
+    if (ch->unbounded) {
+        while (ch->count == 0 && !ch->closed) {
+            int rc = cond_timedwait_deadline(&ch->not_empty, &ch->mutex, &deadline);
+            if (rc == ETIMEDOUT) {
+                pthread_mutex_unlock(&ch->mutex);
+                /* Return none (timeout) */
+                return lean_io_result_mk_ok(lean_box(0));
+            }
+        }
+
+        if (ch->count == 0) {
+            /* Channel closed and drained */
+            pthread_mutex_unlock(&ch->mutex);
+            /* Return some none (closed) */
+            lean_object *outer = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(outer, 0, lean_box(0));
+            return lean_io_result_mk_ok(outer);
+        }
+
+        lean_object *value = unbounded_pop(ch);
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, 1);
+        }
+        pthread_mutex_unlock(&ch->mutex);
+
+        /* Return some (some value) */
+        lean_object *inner = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(inner, 0, value);
+        lean_object *outer = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(outer, 0, inner);
+        return lean_io_result_mk_ok(outer);
+    }
+
+    if (ch->capacity == 0) {
+        /* Unbuffered channel: wait for sender with timeout */
+        while (!ch->pending_ready && !ch->closed) {
+            ch->waiting_receivers++;
+            int rc = cond_timedwait_deadline(&ch->not_empty, &ch->mutex, &deadline);
+            ch->waiting_receivers--;
+            if (rc == ETIMEDOUT) {
+                pthread_mutex_unlock(&ch->mutex);
+                /* Return none (timeout) */
+                return lean_io_result_mk_ok(lean_box(0));
+            }
+        }
+
+        if (ch->pending_ready && !ch->pending_taken) {
+            /* Take the value from sender */
+            lean_object *value = ch->pending_value;
+            ch->pending_taken = true;
+            ch->pending_ready = false;
+            handoff_publish(ch);
+
+            /* Signal sender that we took it */
+            pthread_cond_signal(&ch->not_full);
+            select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+
+            pthread_mutex_unlock(&ch->mutex);
+
+            /* Return some (some value) */
+            lean_object *inner = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(inner, 0, value);
+            lean_object *outer = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(outer, 0, inner);
+            return lean_io_result_mk_ok(outer);
+        }
+
+        /* Channel closed, no pending value */
+        pthread_mutex_unlock(&ch->mutex);
+        /* Return some none (closed) */
+        lean_object *outer = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(outer, 0, lean_box(0));
+        return lean_io_result_mk_ok(outer);
+    } else {
+        /* Buffered channel: wait for data with timeout */
+        while (queued_total(ch) == 0 && !ch->closed) {
+            int rc = cond_timedwait_deadline(&ch->not_empty, &ch->mutex, &deadline);
+            if (rc == ETIMEDOUT) {
+                pthread_mutex_unlock(&ch->mutex);
+                /* Return none (timeout) */
+                return lean_io_result_mk_ok(lean_box(0));
+            }
+        }
+
+        if (queued_total(ch) == 0) {
+            /* Channel closed and empty */
+            pthread_mutex_unlock(&ch->mutex);
+            /* Return some none (closed) */
+            lean_object *outer = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(outer, 0, lean_box(0));
+            return lean_io_result_mk_ok(outer);
+        }
+
+        /* Take from buffer, priority lane first */
+        lean_object *value = channel_pop_locked(ch);
+        buffer_maybe_shrink(ch);
+
+        /* Signal that space is available */
+        pthread_cond_signal(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+
+        pthread_mutex_unlock(&ch->mutex);
+
+        /* Return some (some value) */
+        lean_object *inner = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(inner, 0, value);
+        lean_object *outer = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(outer, 0, inner);
+        return lean_io_result_mk_ok(outer);
+    }
+}
+
+/* ============================================================================
+ * conduit_channel_close : Channel α → IO Unit
+ *
+ * Close the channel. Wakes all waiting senders/receivers.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_close(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    CONDUIT_PROBE1(channel_close, ch);
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (!ch->closed) {
+        ch->closed = true;
+        atomic_store_explicit(&ch->lf_closed, true, memory_order_release);
+
+        /* Wake all waiting threads */
+        pthread_cond_broadcast(&ch->not_empty);
+        pthread_cond_broadcast(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_ANY);
+    }
+
+    pthread_mutex_unlock(&ch->mutex);
+
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/* ============================================================================
+ * conduit_channel_is_closed : Channel α → IO Bool
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_is_closed(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    /* lf_closed mirrors closed for every channel kind, so this is a single
+     * load: a monitoring loop adds no contention to the channel. */
+    bool closed = atomic_load_explicit(&ch->lf_closed, memory_order_acquire);
+
+    return lean_io_result_mk_ok(lean_box(closed ? 1 : 0));
+}
+
+/* ============================================================================
+ * conduit_channel_len : Channel α → IO Nat
+ *
+ * Get current number of items in buffer (0 for unbuffered). Reads the
+ * lock-free depth mirror, so sampling many channels from a monitoring
+ * loop never contends with the channels being sampled. The value is
+ * approximate under concurrent sends/receives.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_len(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    return lean_io_result_mk_ok(lean_usize_to_nat(channel_depth(ch)));
+}
+
+/* ============================================================================
+ * conduit_channel_capacity : Channel α → IO Nat
+ *
+ * Get buffer capacity (0 for unbuffered).
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_capacity(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    /* Capacity is immutable, no lock needed */
+    return lean_io_result_mk_ok(lean_usize_to_nat(ch->capacity));
+}
+
+/* ============================================================================
+ * conduit_channel_set_wait_mode : Channel α → UInt8 → IO Unit
+ *
+ * Set how blocked unbuffered handoffs wait: 0 = park (default),
+ * 1 = hybrid (spin then park), 2 = spin. Unknown values fall back to park.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_set_wait_mode(
+    b_lean_obj_arg ch_obj,
+    uint8_t mode,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    pthread_mutex_lock(&ch->mutex);
+    ch->wait_mode = mode <= WAIT_MODE_SPIN ? mode : WAIT_MODE_PARK;
+    pthread_mutex_unlock(&ch->mutex);
+
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/* ============================================================================
+ * conduit_channel_enable_stats : Channel α → IO Unit
+ *
+ * Turn on statistics collection for this channel. Idempotent.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_enable_stats(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    pthread_mutex_lock(&ch->mutex);
+    if (!ch->stats) {
+        conduit_channel_stats_t *st =
+            (conduit_channel_stats_t *)calloc(1, sizeof(conduit_channel_stats_t));
+        if (!st) {
+            pthread_mutex_unlock(&ch->mutex);
+            return mk_io_error("Failed to allocate channel stats");
+        }
+        ch->stats = st;
+    }
+    pthread_mutex_unlock(&ch->mutex);
+
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/* ============================================================================
+ * conduit_channel_stats : Channel α → IO Channel.Stats
+ *
+ * Read accumulated statistics. All zeros if stats were never enabled.
+ * Field order matches Conduit.Channel.Stats:
+ * sends, recvs, sendBlocks, recvBlocks, blockedNanos, highWater.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_stats(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    conduit_channel_stats_t *st = ch->stats;
+
+    uint64_t sends = 0, recvs = 0, send_blocks = 0, recv_blocks = 0;
+    uint64_t blocked_ns = 0, high_water = 0;
+    if (st) {
+        sends = atomic_load_explicit(&st->sends, memory_order_relaxed);
+        recvs = atomic_load_explicit(&st->recvs, memory_order_relaxed);
+        send_blocks = atomic_load_explicit(&st->send_blocks, memory_order_relaxed);
+        recv_blocks = atomic_load_explicit(&st->recv_blocks, memory_order_relaxed);
+        blocked_ns = atomic_load_explicit(&st->blocked_ns, memory_order_relaxed);
+        high_water = atomic_load_explicit(&st->high_water, memory_order_relaxed);
+    }
+
+    lean_object *result = lean_alloc_ctor(0, 6, 0);
+    lean_ctor_set(result, 0, lean_uint64_to_nat(sends));
+    lean_ctor_set(result, 1, lean_uint64_to_nat(recvs));
+    lean_ctor_set(result, 2, lean_uint64_to_nat(send_blocks));
+    lean_ctor_set(result, 3, lean_uint64_to_nat(recv_blocks));
+    lean_ctor_set(result, 4, lean_uint64_to_nat(blocked_ns));
+    lean_ctor_set(result, 5, lean_uint64_to_nat(high_water));
+    return lean_io_result_mk_ok(result);
+}
+
+/* ============================================================================
+ * conduit_channel_send_all : Channel α → Array α → IO Nat
+ *
+ * Batched non-blocking send. Moves as many values as fit into the circular
+ * buffer under a single lock acquisition, signaling receivers once.
+ * Returns the number of values accepted. Unbuffered channels have no buffer
+ * to batch into, so they always report 0 (callers fall back to send).
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_send_all(
+    b_lean_obj_arg ch_obj,
+    b_lean_obj_arg values_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    size_t n = lean_array_size(values_obj);
+
+    if (n == 0 || (ch->capacity == 0 && !ch->unbounded)) {
+        return lean_io_result_mk_ok(lean_usize_to_nat(0));
+    }
+
+    if (channel_is_fast(ch)) {
+        /* Lock-free ring: loop the atomic enqueue, one wakeup at the end */
+        size_t moved = 0;
+        while (moved < n) {
+            lean_object *value = lean_array_get_core(values_obj, moved);
+            lean_inc(value);
+            if (fast_try_send(ch, value) != 0) {
+                lean_dec(value);
+                break;
+            }
+            moved++;
+        }
+        if (moved > 0) {
+            lf_wake(ch, true);
+        }
+        return lean_io_result_mk_ok(lean_usize_to_nat(moved));
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(lean_usize_to_nat(0));
+    }
+
+    if (ch->unbounded) {
+        /* Unbounded: the whole batch always fits */
+        size_t pushed = 0;
+        while (pushed < n) {
+            lean_object *value = lean_array_get_core(values_obj, pushed);
+            lean_inc(value);
+            if (!unbounded_push(ch, value)) {
+                lean_dec(value);
+                break;
+            }
+            pushed++;
+        }
+        if (pushed > 0) {
+            if (ch->stats) {
+                stats_count(&ch->stats->sends, pushed);
+                stats_high_water(ch->stats, ch->count);
+            }
+            pthread_cond_broadcast(&ch->not_empty);
+            select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+        }
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(lean_usize_to_nat(pushed));
+    }
+
+    /* Move as many values as fit into the ring */
+    size_t space = ch->capacity - ch->count;
+    size_t moved = n < space ? n : space;
+
+    if (moved > 0 && !buffer_reserve(ch, ch->count + moved)) {
+        pthread_mutex_unlock(&ch->mutex);
+        return mk_io_error("Failed to allocate channel buffer");
+    }
+
+    for (size_t i = 0; i < moved; i++) {
+        lean_object *value = lean_array_get_core(values_obj, i);
+        lean_inc(value);  /* Array is borrowed; buffer takes its own reference */
+        ch->buffer[ch->tail] = value;
+        ch->tail = (ch->tail + 1) % ch->buf_cap;
+    }
+    ch->count += moved;
+    depth_publish(ch);
+
+    if (moved > 0) {
+        if (ch->stats) {
+            stats_count(&ch->stats->sends, moved);
+            stats_high_water(ch->stats, ch->count);
+        }
+        /* One wakeup for the whole batch */
+        pthread_cond_broadcast(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+    }
+
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(lean_usize_to_nat(moved));
+}
+
+/* ============================================================================
+ * conduit_channel_recv_up_to : Channel α → Nat → IO (Array α)
+ *
+ * Batched non-blocking receive. Drains up to max values from the circular
+ * buffer under a single lock acquisition, signaling senders once.
+ * Returns an empty array if nothing is available (or the channel is
+ * unbuffered with no pending handoff).
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_recv_up_to(
+    b_lean_obj_arg ch_obj,
+    b_lean_obj_arg max_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    size_t max = lean_usize_of_nat(max_obj);
+
+    if (max == 0) {
+        return lean_io_result_mk_ok(lean_alloc_array(0, 0));
+    }
+
+    if (channel_is_fast(ch)) {
+        /* Lock-free ring: loop the atomic dequeue, one wakeup at the end */
+        lean_object *arr = lean_mk_empty_array();
+        lean_object *value;
+        size_t moved = 0;
+        while (moved < max && fast_try_recv(ch, &value) == 0) {
+            arr = lean_array_push(arr, value);
+            moved++;
+        }
+        if (moved > 0) {
+            lf_wake(ch, false);
+        }
+        return lean_io_result_mk_ok(arr);
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->unbounded) {
+        size_t moved = ch->count < max ? ch->count : max;
+        lean_object *arr = lean_alloc_array(moved, moved);
+        for (size_t i = 0; i < moved; i++) {
+            lean_array_set_core(arr, i, unbounded_pop(ch));
+        }
+        if (moved > 0 && ch->stats) {
+            stats_count(&ch->stats->recvs, moved);
+        }
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(arr);
+    }
+
+    if (ch->capacity == 0) {
+        /* Unbuffered: at most one pending handoff can be taken */
+        if (ch->pending_ready && !ch->pending_taken) {
+            lean_object *value = ch->pending_value;
+            ch->pending_taken = true;
+            ch->pending_ready = false;
+            handoff_publish(ch);
+            pthread_cond_signal(&ch->not_full);
+            select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+            pthread_mutex_unlock(&ch->mutex);
+
+            lean_object *arr = lean_alloc_array(1, 1);
+            lean_array_set_core(arr, 0, value);
+            return lean_io_result_mk_ok(arr);
+        }
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(lean_alloc_array(0, 0));
+    }
+
+    size_t total = queued_total(ch);
+    size_t moved = total < max ? total : max;
+    lean_object *arr = lean_alloc_array(moved, moved);
+
+    for (size_t i = 0; i < moved; i++) {
+        lean_array_set_core(arr, i, channel_pop_locked(ch));
+    }
+    buffer_maybe_shrink(ch);
+
+    if (moved > 0) {
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, moved);
+        }
+        /* One wakeup for the whole batch */
+        pthread_cond_broadcast(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+    }
+
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(arr);
+}
+
+/* ============================================================================
+ * conduit_channel_recv_many : Channel α → Nat → IO (Array α)
+ *
+ * Batched blocking receive. Blocks until at least one value is available,
+ * then drains up to max values under the single lock acquisition the wakeup
+ * already paid for. An empty array means the channel is closed and drained
+ * (or the task was canceled), mirroring recv returning none.
+ * ============================================================================ */
+
+/* Shared by conduit_channel_recv_many and conduit_channel_drain.
+ * Returns an owned array; empty means closed-and-drained or canceled. */
+static lean_object *recv_many_core(conduit_channel_t *ch, size_t max) {
+    if (channel_is_fast(ch)) {
+        /* Lock-free ring: block for the first value, then drain atomically */
+        lean_object *value;
+        if (lf_recv_block(ch, &value, NULL) != 0) {
+            return lean_alloc_array(0, 0);
+        }
+        lean_object *arr = lean_mk_empty_array();
+        arr = lean_array_push(arr, value);
+        size_t moved = 1;
+        while (moved < max && fast_try_recv(ch, &value) == 0) {
+            arr = lean_array_push(arr, value);
+            moved++;
+        }
+        /* One wakeup for the whole batch */
+        lf_wake(ch, false);
+        return arr;
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->capacity == 0 && !ch->unbounded) {
+        /* Unbuffered: a wakeup hands off at most one pending value */
+        bool st_blocked = false;
+        uint64_t st_t0 = 0;
+        while (!ch->pending_ready && !ch->closed) {
+            if (ch->stats && !st_blocked) {
+                st_blocked = true;
+                stats_count(&ch->stats->recv_blocks, 1);
+                st_t0 = stats_now_ns();
+            }
+            ch->waiting_receivers++;
+            int rc = cond_wait_interruptible(&ch->not_empty, &ch->mutex);
+            ch->waiting_receivers--;
+            if (rc == ECANCELED) {
+                pthread_mutex_unlock(&ch->mutex);
+                return lean_alloc_array(0, 0);
+            }
+        }
+
+        if (ch->stats && st_blocked) {
+            stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+        }
+
+        if (ch->pending_ready && !ch->pending_taken) {
+            lean_object *value = ch->pending_value;
+            ch->pending_taken = true;
+            ch->pending_ready = false;
+            handoff_publish(ch);
+
+            if (ch->stats) {
+                stats_count(&ch->stats->recvs, 1);
+            }
+
+            pthread_cond_signal(&ch->not_full);
+            select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+            pthread_mutex_unlock(&ch->mutex);
+
+            lean_object *arr = lean_alloc_array(1, 1);
+            lean_array_set_core(arr, 0, value);
+            return arr;
+        }
+
+        /* Channel closed, no pending value */
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_alloc_array(0, 0);
+    }
+
+    /* Buffered or unbounded: wait for data, then bulk-copy the backlog */
+    bool st_blocked = false;
+    uint64_t st_t0 = 0;
+    while (queued_total(ch) == 0 && !ch->closed) {
+        if (ch->stats && !st_blocked) {
+            st_blocked = true;
+            stats_count(&ch->stats->recv_blocks, 1);
+            st_t0 = stats_now_ns();
+        }
+        if (cond_wait_interruptible(&ch->not_empty, &ch->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&ch->mutex);
+            return lean_alloc_array(0, 0);
+        }
+    }
+
+    if (ch->stats && st_blocked) {
+        stats_count(&ch->stats->blocked_ns, stats_now_ns() - st_t0);
+    }
+
+    size_t total = ch->unbounded ? ch->count : queued_total(ch);
+    size_t moved = total < max ? total : max;
+    lean_object *arr = lean_alloc_array(moved, moved);
+
+    if (ch->unbounded) {
+        for (size_t i = 0; i < moved; i++) {
+            lean_array_set_core(arr, i, unbounded_pop(ch));
+        }
+    } else {
+        for (size_t i = 0; i < moved; i++) {
+            lean_array_set_core(arr, i, channel_pop_locked(ch));
+        }
+        buffer_maybe_shrink(ch);
+
+        if (moved > 0) {
+            /* One wakeup for the whole batch */
+            pthread_cond_broadcast(&ch->not_full);
+            select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+        }
+    }
+
+    if (moved > 0 && ch->stats) {
+        stats_count(&ch->stats->recvs, moved);
+    }
+
+    pthread_mutex_unlock(&ch->mutex);
+    return arr;
+}
+
+LEAN_EXPORT lean_obj_res conduit_channel_recv_many(
+    b_lean_obj_arg ch_obj,
+    b_lean_obj_arg max_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    size_t max = lean_usize_of_nat(max_obj);
+
+    if (max == 0) {
+        return lean_io_result_mk_ok(lean_alloc_array(0, 0));
+    }
+
+    return lean_io_result_mk_ok(recv_many_core(ch, max));
+}
+
+/* ============================================================================
+ * conduit_channel_drain : Channel α → IO (Array α)
+ *
+ * Collect every remaining value into an array, blocking until the channel
+ * closes. Each wakeup bulk-copies whatever is buffered instead of paying a
+ * lock/signal round trip per element.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_drain(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    lean_object *acc = NULL;
+    for (;;) {
+        lean_object *chunk = recv_many_core(ch, SIZE_MAX);
+        size_t n = lean_array_size(chunk);
+        if (n == 0) {
+            lean_dec(chunk);
+            break;
+        }
+        if (acc == NULL) {
+            /* First chunk becomes the result directly */
+            acc = chunk;
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            lean_object *v = lean_array_get_core(chunk, i);
+            lean_inc(v);
+            acc = lean_array_push(acc, v);
+        }
+        lean_dec(chunk);
+    }
+
+    if (acc == NULL) {
+        acc = lean_alloc_array(0, 0);
+    }
+    return lean_io_result_mk_ok(acc);
+}
+
+/* ============================================================================
+ * Select Waiter Helpers
+ * ============================================================================ */
+
+/* Register a select waiter on a channel (called with channel mutex held).
+ * The seq_cst store and fence pair with the seq_cst load in lf_wake: the
+ * selector's registration must be globally visible before its readiness
+ * re-check loads the ring, or a fast-path producer that enqueued between
+ * the two could see no waiters and skip the wake - a lost wakeup. */
+static void select_register_waiter(conduit_channel_t *ch, conduit_select_waiter_t *w) {
+    w->next = atomic_load_explicit(&ch->select_waiters, memory_order_relaxed);
+    atomic_store_explicit(&ch->select_waiters, w, memory_order_seq_cst);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/* Unregister a select waiter from a channel (called with channel mutex held) */
+static void select_unregister_waiter(conduit_channel_t *ch, conduit_select_waiter_t *w) {
+    conduit_select_waiter_t *head =
+        atomic_load_explicit(&ch->select_waiters, memory_order_relaxed);
+    if (head == w) {
+        atomic_store_explicit(&ch->select_waiters, w->next,
+                              memory_order_seq_cst);
+        return;
+    }
+    for (conduit_select_waiter_t *p = head; p != NULL; p = p->next) {
+        if (p->next == w) {
+            p->next = w->next;
+            return;
+        }
+    }
+}
+
+/* Does this waiter have a case on ch that the event could satisfy?
+ * Reads the waiter's (immutable) case array; safe while it is registered. */
+static bool select_waiter_eligible(
+    conduit_select_waiter_t *w,
+    conduit_channel_t *ch,
+    conduit_select_event_t event
+) {
+    if (w->cases == NULL) {
+        /* Fixed-arity waiter: cases live inline */
+        for (uint8_t i = 0; i < w->fixed_n; i++) {
+            if (w->fixed_ch[i] != ch) {
+                continue;
+            }
+            if (event == SELECT_EVENT_SEND_READY ? w->fixed_send[i]
+                                                 : !w->fixed_send[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+    size_t n = lean_array_size(w->cases);
+    for (size_t i = 0; i < n; i++) {
+        lean_object *pair = lean_array_get_core(w->cases, i);
+        lean_object *ch_obj = lean_ctor_get(pair, 0);
+        if ((conduit_channel_t *)lean_get_external_data(ch_obj) != ch) {
+            continue;
+        }
+        bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+        if (event == SELECT_EVENT_SEND_READY ? is_send : !is_send) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Notify select waiters on a channel (called with channel mutex held).
+ *
+ * For a directed event (data arrived / space freed) this wakes only the
+ * first sleeping waiter with a matching case, recording the channel in the
+ * waiter so it can resolve its ready index by checking this channel alone -
+ * wake-one with direct handoff instead of a thundering herd. Waiters that
+ * were already notified are skipped: they are awake and will re-poll anyway,
+ * and the readiness this event produced persists until consumed.
+ *
+ * SELECT_EVENT_ANY (close, cancellation kick) wakes every waiter and forces
+ * a full re-poll, since any number of cases may have become ready. */
+static void select_notify_waiters(conduit_channel_t *ch, conduit_select_event_t event) {
+    conduit_select_waiter_t *w =
+        atomic_load_explicit(&ch->select_waiters, memory_order_relaxed);
+    while (w != NULL) {
+        if (event == SELECT_EVENT_ANY) {
+            pthread_mutex_lock(w->mutex);
+            w->ready_ch = NULL;  /* Force full poll */
+            w->notified = true;
+            pthread_cond_signal(w->cond);
+            pthread_mutex_unlock(w->mutex);
+        } else if (!w->notified && select_waiter_eligible(w, ch, event)) {
+            pthread_mutex_lock(w->mutex);
+            if (!w->notified) {
+                w->ready_ch = ch;
+                w->notified = true;
+                pthread_cond_signal(w->cond);
+                pthread_mutex_unlock(w->mutex);
+                return;  /* Wake one */
+            }
+            pthread_mutex_unlock(w->mutex);
+        }
+        w = w->next;
+    }
+}
+
+/* ============================================================================
+ * Select Implementation
+ * ============================================================================ */
+
+/* Readiness check shared by poll and wait.
+ * Called with the channel mutex held for mutex-based channels;
+ * lock-free channels are inspected with atomic loads only. */
+static bool channel_ready(conduit_channel_t *ch, bool is_send) {
+    if (channel_is_fast(ch)) {
+        size_t depth = lf_depth(ch);
+        if (is_send) {
+            return !atomic_load_explicit(&ch->lf_closed, memory_order_acquire)
+                && depth < ch->capacity;
+        }
+        return depth > 0
+            || atomic_load_explicit(&ch->lf_closed, memory_order_acquire);
+    }
+    if (ch->unbounded) {
+        /* Send never blocks while open; recv is ready with data or on close */
+        return is_send ? !ch->closed : (ch->count > 0 || ch->closed);
+    }
+    if (is_send) {
+        /* Can send if: not closed AND (buffered with space OR unbuffered
+         * with waiting receiver and no send in progress) */
+        if (ch->closed) return false;
+        if (ch->capacity > 0) return ch->count < ch->capacity;
+        return ch->waiting_receivers > 0 && !ch->pending_ready;
+    }
+    /* Can recv if: has data OR pending handoff not yet taken OR closed */
+    return queued_total(ch) > 0 || (ch->pending_ready && !ch->pending_taken) || ch->closed;
+}
+
+/* Recv readiness without the closed clause: true only while the channel
+ * holds something a receiver could actually take. Used where a
+ * closed-and-drained channel must not count as ready (recvAny's
+ * post-registration re-check would otherwise spin on it). Same locking
+ * contract as channel_ready. */
+static bool channel_recv_has_data(conduit_channel_t *ch) {
+    if (channel_is_fast(ch)) {
+        return lf_depth(ch) > 0;
+    }
+    if (ch->unbounded) {
+        return ch->count > 0;
+    }
+    return queued_total(ch) > 0 || (ch->pending_ready && !ch->pending_taken);
+}
+
+/* Rotation counter for the wait path: each wait starts its readiness scan
+ * at a different offset so a permanently-ready low-index case cannot
+ * starve higher-index ones. */
+static _Atomic size_t g_select_rotation = 0;
+
+/* Poll the cases starting at offset start (indices wrap). Returns the
+ * index of the first ready case in scan order, or none. */
+static lean_obj_res select_poll_from(
+    b_lean_obj_arg cases_obj,
+    size_t start,
+    lean_obj_arg world
+) {
+    (void)world;
+
+    size_t n = lean_array_size(cases_obj);
+
+    for (size_t k = 0; k < n; k++) {
+        size_t i = (start + k) % n;
+        lean_object *pair = lean_array_get_core(cases_obj, i);
+        lean_object *ch_obj = lean_ctor_get(pair, 0);
+        bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+
+        conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+        pthread_mutex_lock(&ch->mutex);
+        bool ready = channel_ready(ch, is_send);
+        pthread_mutex_unlock(&ch->mutex);
+
+        if (ready) {
+            /* Return Some i */
+            lean_object *some = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(some, 0, lean_usize_to_nat(i));
+            return lean_io_result_mk_ok(some);
+        }
+    }
+
+    /* None ready */
+    return lean_io_result_mk_ok(lean_box(0)); /* none */
+}
+
+/*
+ * conduit_select_poll : Array (Channel × Bool) → IO (Option Nat)
+ *
+ * Poll an array of (channel, is_send) pairs. Returns index of first ready
+ * channel in case order (deterministic, documented), or none if none are
+ * ready. The wait path rotates its scans instead; see select_wait_core.
+ *
+ * is_send: true = check if can send, false = check if can recv
+ */
+LEAN_EXPORT lean_obj_res conduit_select_poll(
+    b_lean_obj_arg cases_obj,
+    lean_obj_arg world
+) {
+    return select_poll_from(cases_obj, 0, world);
+}
+
+/*
+ * conduit_select_poll_all : Array (Channel × Bool) → IO (Array Nat)
+ *
+ * One sweep over the cases returning every currently-ready index in case
+ * order. Lets a dispatcher drain all ready channels per wakeup instead of
+ * re-entering select (re-locking every channel) once per message.
+ */
+LEAN_EXPORT lean_obj_res conduit_select_poll_all(
+    b_lean_obj_arg cases_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+
+    size_t n = lean_array_size(cases_obj);
+    lean_object *ready = lean_mk_empty_array();
+
+    for (size_t i = 0; i < n; i++) {
+        lean_object *pair = lean_array_get_core(cases_obj, i);
+        lean_object *ch_obj = lean_ctor_get(pair, 0);
+        bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+
+        conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+        pthread_mutex_lock(&ch->mutex);
+        bool is_ready = channel_ready(ch, is_send);
+        pthread_mutex_unlock(&ch->mutex);
+
+        if (is_ready) {
+            ready = lean_array_push(ready, lean_usize_to_nat(i));
+        }
+    }
+
+    return lean_io_result_mk_ok(ready);
+}
+
+/* Comparison function for sorting channels by address */
+static int compare_channels(const void *a, const void *b) {
+    conduit_channel_t *ca = *(conduit_channel_t **)a;
+    conduit_channel_t *cb = *(conduit_channel_t **)b;
+    if (ca < cb) return -1;
+    if (ca > cb) return 1;
+    return 0;
+}
+
+/* Shared wait loop for select_wait and prepared selects.
+ *
+ * The caller supplies the sorted, deduplicated channel set and the waiter's
+ * sync primitives; this function only registers/deregisters the waiter and
+ * sleeps, so prepared selects pay no allocation or primitive-init cost.
+ * timeout_ms = 0 means wait forever. */
+static lean_obj_res select_wait_core(
+    b_lean_obj_arg cases_obj,
+    size_t timeout_ms,
+    conduit_channel_t **channels,
+    size_t unique_count,
+    pthread_mutex_t *wait_mutex,
+    pthread_cond_t *wait_cond,
+    conduit_select_waiter_t *waiter,
+    lean_obj_arg world
+) {
+    size_t n = lean_array_size(cases_obj);
+    lean_object *result;
+    lean_object *inner;
+    bool canceled = false;
+
+    /* Fairness: when several cases are ready at once, resolve the tie
+     * starting from a rotating offset so repeated waits don't always pick
+     * the lowest index. */
+    size_t rot = (n > 0)
+        ? atomic_fetch_add_explicit(&g_select_rotation, 1,
+                                    memory_order_relaxed) % n
+        : 0;
+
+retry:
+    /* 1. First poll without waiting (fast path) */
+    result = select_poll_from(cases_obj, rot, world);
+    inner = lean_ctor_get(result, 0);
+    if (!lean_is_scalar(inner)) {
+        return result; /* Already ready */
+    }
+    lean_dec(result);
+
+    /* 2. Reset waiter state for this round */
+    waiter->cond = wait_cond;
+    waiter->mutex = wait_mutex;
+    waiter->notified = false;
+    waiter->next = NULL;
+    waiter->cases = cases_obj;
+    waiter->ready_ch = NULL;
+
+    /* 3. Lock all channels (in sorted order) and register waiter */
+    for (size_t i = 0; i < unique_count; i++) {
+        pthread_mutex_lock(&channels[i]->mutex);
+        select_register_waiter(channels[i], waiter);
+    }
+
+    /* 4. Check if any ready now (may have become ready while registering) */
+    bool found_ready = false;
+    for (size_t i = 0; i < n && !found_ready; i++) {
+        lean_object *pair = lean_array_get_core(cases_obj, i);
+        lean_object *ch_obj = lean_ctor_get(pair, 0);
+        bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+        conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+        /* Note: we already hold the lock on this channel */
+        if (channel_ready(ch, is_send)) {
+            found_ready = true;
+        }
+    }
+
+    if (found_ready) {
+        /* Unregister and unlock immediately */
+        for (size_t i = unique_count; i > 0; i--) {
+            select_unregister_waiter(channels[i-1], waiter);
+            pthread_mutex_unlock(&channels[i-1]->mutex);
+        }
+        return select_poll_from(cases_obj, rot, world);
+    }
+
+    /* A select that is all sends on closed channels can never fire.
+     * Checked before sleeping - when the closes predate this call no
+     * notification will ever arrive to trigger the post-wake retry
+     * check below. We hold every channel lock here. (With a timeout
+     * the sleep bounds the wait, so only the forever case needs it.) */
+    if (timeout_ms == 0) {
+        bool pre_all_send_closed = true;
+        for (size_t i = 0; i < n && pre_all_send_closed; i++) {
+            lean_object *pair = lean_array_get_core(cases_obj, i);
+            lean_object *ch_obj = lean_ctor_get(pair, 0);
+            bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+            if (!is_send || !conduit_channel_unbox(ch_obj)->closed) {
+                pre_all_send_closed = false;
+            }
+        }
+        if (pre_all_send_closed) {
+            for (size_t i = unique_count; i > 0; i--) {
+                select_unregister_waiter(channels[i-1], waiter);
+                pthread_mutex_unlock(&channels[i-1]->mutex);
+            }
+            return lean_io_result_mk_ok(lean_box(0)); /* none */
+        }
+    }
+
+    /* 5. Not ready - unlock channels and wait on condition */
+    pthread_mutex_lock(wait_mutex);
+    for (size_t i = unique_count; i > 0; i--) {
+        pthread_mutex_unlock(&channels[i-1]->mutex);
+    }
+
+    /* 6. Wait loop with timeout */
+    struct timespec deadline;
+    if (timeout_ms > 0) {
+        deadline_after_ms(&deadline, timeout_ms);
+    }
+
+    while (!waiter->notified) {
+        if (timeout_ms == 0) {
+            if (cond_wait_interruptible(wait_cond, wait_mutex) == ECANCELED) {
+                canceled = true;
+                break;
+            }
+        } else {
+            int rc = cond_timedwait_deadline(wait_cond, wait_mutex, &deadline);
+            if (rc == ETIMEDOUT) {
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(wait_mutex);
+
+    /* 7. Unregister from all channels */
+    for (size_t i = 0; i < unique_count; i++) {
+        pthread_mutex_lock(&channels[i]->mutex);
+        select_unregister_waiter(channels[i], waiter);
+        pthread_mutex_unlock(&channels[i]->mutex);
+    }
+
+    /* 8. Direct handoff: a targeted wakeup recorded which channel signaled,
+     * so resolve the index by checking that channel alone instead of
+     * re-polling (and re-locking) every case. */
+    if (waiter->notified && waiter->ready_ch != NULL && !canceled) {
+        conduit_channel_t *rch = waiter->ready_ch;
+        size_t ready_index = n;
+        pthread_mutex_lock(&rch->mutex);
+        for (size_t i = 0; i < n; i++) {
+            lean_object *pair = lean_array_get_core(cases_obj, i);
+            lean_object *ch_obj = lean_ctor_get(pair, 0);
+            if (conduit_channel_unbox(ch_obj) != rch) {
+                continue;
+            }
+            bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+            if (channel_ready(rch, is_send)) {
+                ready_index = i;
+                break;
+            }
+        }
+        pthread_mutex_unlock(&rch->mutex);
+        if (ready_index < n) {
+            lean_object *some = lean_alloc_ctor(1, 1, 0);
+            lean_ctor_set(some, 0, lean_usize_to_nat(ready_index));
+            return lean_io_result_mk_ok(some);
+        }
+        /* Readiness was consumed before we got here - fall back to a
+         * full poll (and possibly another sleep). */
+    }
+
+    /* 9. Final poll to get ready index */
+    result = select_poll_from(cases_obj, rot, world);
+
+    if (timeout_ms == 0 && !canceled) {
+        lean_object *final_inner = lean_ctor_get(result, 0);
+        if (lean_is_scalar(final_inner)) {
+            bool all_send_closed = true;
+            for (size_t i = 0; i < n; i++) {
+                lean_object *pair = lean_array_get_core(cases_obj, i);
+                lean_object *ch_obj = lean_ctor_get(pair, 0);
+                bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+
+                if (!is_send) {
+                    all_send_closed = false;
+                    break;
+                }
+
+                conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+                pthread_mutex_lock(&ch->mutex);
+                bool closed = ch->closed;
+                pthread_mutex_unlock(&ch->mutex);
+
+                if (!closed) {
+                    all_send_closed = false;
+                    break;
+                }
+            }
+
+            if (!all_send_closed) {
+                lean_dec(result);
+                goto retry;
+            }
+        }
+    }
+
+    return result;
+}
+
+/* Collect the unique channels in a case array, sorted by address (the lock
+ * order used everywhere multiple channels are held). Returns a malloc'd
+ * array or NULL; writes the deduplicated length to *out_unique. */
+static conduit_channel_t **select_collect_channels(
+    b_lean_obj_arg cases_obj,
+    size_t *out_unique
+) {
+    size_t n = lean_array_size(cases_obj);
+    conduit_channel_t **channels =
+        (conduit_channel_t **)malloc(n * sizeof(conduit_channel_t *));
+    if (!channels) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        lean_object *pair = lean_array_get_core(cases_obj, i);
+        lean_object *ch_obj = lean_ctor_get(pair, 0);
+        channels[i] = conduit_channel_unbox(ch_obj);
+    }
+
+    /* Sort by address to prevent deadlock when locking multiple channels */
+    qsort(channels, n, sizeof(conduit_channel_t *), compare_channels);
+
+    /* Remove duplicates (keep unique channels only) */
+    size_t unique_count = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (unique_count == 0 || channels[i] != channels[unique_count - 1]) {
+            channels[unique_count++] = channels[i];
+        }
+    }
+
+    *out_unique = unique_count;
+    return channels;
+}
+
+/*
+ * conduit_select_wait : Array (Channel × Bool) → Nat → IO (Option Nat)
+ *
+ * Wait for any channel to become ready, with timeout in milliseconds.
+ * timeout = 0 means wait forever.
+ * Returns index of ready channel, or none on timeout.
+ *
+ * Uses proper condition variable signaling for immediate wake-up.
+ */
+static lean_obj_res conduit_select_wait_impl(
+    b_lean_obj_arg cases_obj,
+    b_lean_obj_arg timeout_obj,
+    lean_obj_arg world
+) {
+    size_t n = lean_array_size(cases_obj);
+    if (n == 0) {
+        return lean_io_result_mk_ok(lean_box(0)); /* none */
+    }
+
+    size_t timeout_ms = lean_usize_of_nat(timeout_obj);
+
+    /* Poll before paying any setup cost */
+    lean_object *result = conduit_select_poll(cases_obj, world);
+    lean_object *inner = lean_ctor_get(result, 0);
+    if (!lean_is_scalar(inner)) {
+        return result; /* Already ready */
+    }
+    lean_dec(result);
+
+    size_t unique_count = 0;
+    conduit_channel_t **channels = select_collect_channels(cases_obj, &unique_count);
+    if (!channels) {
+        return lean_io_result_mk_ok(lean_box(0)); /* none on alloc failure */
+    }
+
+    pthread_mutex_t wait_mutex;
+    pthread_cond_t wait_cond;
+    pthread_mutex_init(&wait_mutex, NULL);
+    cond_init_monotonic(&wait_cond);
+    conduit_select_waiter_t waiter;
+
+    result = select_wait_core(cases_obj, timeout_ms, channels, unique_count,
+                              &wait_mutex, &wait_cond, &waiter, world);
+
+    pthread_cond_destroy(&wait_cond);
+    pthread_mutex_destroy(&wait_mutex);
+    free(channels);
+    return result;
+}
+
+LEAN_EXPORT lean_obj_res conduit_select_wait(
+    b_lean_obj_arg cases_obj,
+    b_lean_obj_arg timeout_obj,
+    lean_obj_arg world
+) {
+    TELEM_START(t0);
+    lean_obj_res result = conduit_select_wait_impl(cases_obj, timeout_obj, world);
+    TELEM_END(TELEM_OP_SELECT_WAIT, t0);
+    return result;
+}
+
+/* ============================================================================
+ * Fixed-Arity Select (Select.recv2 / recv3 / recvSend)
+ *
+ * The general path builds an Array (Channel × Bool) of boxed pairs per
+ * call, then mallocs and qsorts to recover the channel set and boxes a
+ * Nat on the way out. For selects over two or three statically-known
+ * channels - the overwhelmingly common shape in tight event loops - the
+ * fixed-arity entry points take the handles directly, keep the case set
+ * on the stack (the waiter carries it inline; see fixed_ch in
+ * conduit_select_waiter_t), and return an unboxed tag. Same wake-one /
+ * direct-handoff protocol and rotating tie-breaking as select_wait_core.
+ * ============================================================================ */
+
+/* Tag returned when no case can become ready: the calling task was
+ * canceled, or every case is a send on a closed channel. */
+#define SELECT_FIXED_NONE 255
+
+/* One readiness sweep starting at rot. Returns a case index or SIZE_MAX. */
+static size_t select_fixed_poll(
+    conduit_channel_t *const *chs,
+    const bool *sends,
+    size_t n,
+    size_t rot
+) {
+    for (size_t k = 0; k < n; k++) {
+        size_t i = (rot + k) % n;
+        conduit_channel_t *ch = chs[i];
+        pthread_mutex_lock(&ch->mutex);
+        bool ready = channel_ready(ch, sends[i]);
+        pthread_mutex_unlock(&ch->mutex);
+        if (ready) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+/* Block until one of up to three cases is ready; returns its index, or
+ * SELECT_FIXED_NONE if no case can ever be (see above). */
+static uint8_t select_fixed_wait(
+    conduit_channel_t *const *chs,
+    const bool *sends,
+    size_t n
+) {
+    size_t rot = atomic_fetch_add_explicit(&g_select_rotation, 1,
+                                           memory_order_relaxed) % n;
+
+    /* Dedup and sort the (at most 3) channels into lock order */
+    conduit_channel_t *uniq[3];
+    size_t un = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t j = 0;
+        while (j < un && uniq[j] != chs[i]) {
+            j++;
+        }
+        if (j == un) {
+            uniq[un++] = chs[i];
+        }
+    }
+    for (size_t a = 0; a + 1 < un; a++) {
+        for (size_t b = a + 1; b < un; b++) {
+            if (uniq[b] < uniq[a]) {
+                conduit_channel_t *tmp = uniq[a];
+                uniq[a] = uniq[b];
+                uniq[b] = tmp;
+            }
+        }
+    }
+
+    pthread_mutex_t wait_mutex;
+    pthread_cond_t wait_cond;
+    pthread_mutex_init(&wait_mutex, NULL);
+    cond_init_monotonic(&wait_cond);
+    conduit_select_waiter_t waiter;
+    uint8_t result = SELECT_FIXED_NONE;
+
+    for (;;) {
+        /* Fast path: ready without registering */
+        size_t idx = select_fixed_poll(chs, sends, n, rot);
+        if (idx != SIZE_MAX) {
+            result = (uint8_t)idx;
+            break;
+        }
+
+        waiter.cond = &wait_cond;
+        waiter.mutex = &wait_mutex;
+        waiter.notified = false;
+        waiter.next = NULL;
+        waiter.cases = NULL;
+        waiter.ready_ch = NULL;
+        for (size_t i = 0; i < n; i++) {
+            waiter.fixed_ch[i] = chs[i];
+            waiter.fixed_send[i] = sends[i];
+        }
+        waiter.fixed_n = (uint8_t)n;
+
+        for (size_t i = 0; i < un; i++) {
+            pthread_mutex_lock(&uniq[i]->mutex);
+            select_register_waiter(uniq[i], &waiter);
+        }
+
+        /* Readiness may have arrived while registering; we hold every lock */
+        bool found = false;
+        for (size_t i = 0; i < n && !found; i++) {
+            found = channel_ready(chs[i], sends[i]);
+        }
+        if (found) {
+            for (size_t i = un; i > 0; i--) {
+                select_unregister_waiter(uniq[i - 1], &waiter);
+                pthread_mutex_unlock(&uniq[i - 1]->mutex);
+            }
+            continue; /* The re-poll resolves the index */
+        }
+
+        /* A select that is all sends on closed channels can never fire.
+         * Checked before sleeping - the close may predate this call, in
+         * which case no notification will ever arrive. We hold every
+         * channel lock here, so the verdict cannot race a close. */
+        bool all_send_closed = true;
+        for (size_t i = 0; i < n && all_send_closed; i++) {
+            if (!sends[i] || !chs[i]->closed) {
+                all_send_closed = false;
+            }
+        }
+        if (all_send_closed) {
+            for (size_t i = un; i > 0; i--) {
+                select_unregister_waiter(uniq[i - 1], &waiter);
+                pthread_mutex_unlock(&uniq[i - 1]->mutex);
+            }
+            break; /* result stays SELECT_FIXED_NONE */
+        }
+
+        pthread_mutex_lock(&wait_mutex);
+        for (size_t i = un; i > 0; i--) {
+            pthread_mutex_unlock(&uniq[i - 1]->mutex);
+        }
+
+        bool canceled = false;
+        while (!waiter.notified) {
+            if (cond_wait_interruptible(&wait_cond, &wait_mutex) == ECANCELED) {
+                canceled = true;
+                break;
+            }
+        }
+        pthread_mutex_unlock(&wait_mutex);
+
+        for (size_t i = 0; i < un; i++) {
+            pthread_mutex_lock(&uniq[i]->mutex);
+            select_unregister_waiter(uniq[i], &waiter);
+            pthread_mutex_unlock(&uniq[i]->mutex);
+        }
+
+        if (canceled) {
+            break;
+        }
+
+        /* Direct handoff: resolve against the signaling channel alone */
+        if (waiter.ready_ch != NULL) {
+            conduit_channel_t *rch = waiter.ready_ch;
+            size_t ridx = SIZE_MAX;
+            pthread_mutex_lock(&rch->mutex);
+            for (size_t i = 0; i < n; i++) {
+                if (chs[i] == rch && channel_ready(rch, sends[i])) {
+                    ridx = i;
+                    break;
+                }
+            }
+            pthread_mutex_unlock(&rch->mutex);
+            if (ridx != SIZE_MAX) {
+                result = (uint8_t)ridx;
+                break;
+            }
+            /* Readiness was consumed before we got here - go around; the
+             * pre-sleep check above terminates if every send case has
+             * meanwhile closed. */
+        }
+    }
+
+    pthread_cond_destroy(&wait_cond);
+    pthread_mutex_destroy(&wait_mutex);
+    return result;
+}
+
+/*
+ * conduit_select2_rr : Channel α → Channel β → IO UInt8
+ *
+ * Wait to receive from either channel; 0 or 1 is the ready case.
+ */
+LEAN_EXPORT lean_obj_res conduit_select2_rr(
+    b_lean_obj_arg ch1_obj,
+    b_lean_obj_arg ch2_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *chs[2] = {
+        conduit_channel_unbox(ch1_obj),
+        conduit_channel_unbox(ch2_obj)
+    };
+    static const bool sends[2] = { false, false };
+    return lean_io_result_mk_ok(lean_box(select_fixed_wait(chs, sends, 2)));
+}
+
+/*
+ * conduit_select3_rrr : Channel α → Channel β → Channel γ → IO UInt8
+ *
+ * Wait to receive from any of three channels; 0, 1 or 2 is the ready case.
+ */
+LEAN_EXPORT lean_obj_res conduit_select3_rrr(
+    b_lean_obj_arg ch1_obj,
+    b_lean_obj_arg ch2_obj,
+    b_lean_obj_arg ch3_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *chs[3] = {
+        conduit_channel_unbox(ch1_obj),
+        conduit_channel_unbox(ch2_obj),
+        conduit_channel_unbox(ch3_obj)
+    };
+    static const bool sends[3] = { false, false, false };
+    return lean_io_result_mk_ok(lean_box(select_fixed_wait(chs, sends, 3)));
+}
+
+/*
+ * conduit_select2_rs : Channel α → Channel β → IO UInt8
+ *
+ * Wait to receive from the first channel or for send readiness on the
+ * second; 0 = recv case ready, 1 = send case ready.
+ */
+LEAN_EXPORT lean_obj_res conduit_select2_rs(
+    b_lean_obj_arg recv_ch_obj,
+    b_lean_obj_arg send_ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *chs[2] = {
+        conduit_channel_unbox(recv_ch_obj),
+        conduit_channel_unbox(send_ch_obj)
+    };
+    static const bool sends[2] = { false, true };
+    return lean_io_result_mk_ok(lean_box(select_fixed_wait(chs, sends, 2)));
+}
+
+/* ============================================================================
+ * Prepared Select
+ *
+ * A compiled select set: the sorted unique channel array and the waiter's
+ * sync primitives are built once at prepare time, so each wait only has to
+ * register, sleep, and deregister. The case array is retained for the
+ * lifetime of the handle.
+ * ============================================================================ */
+
+typedef struct {
+    lean_object *cases_obj;        /* retained Array (Channel × Bool) */
+    conduit_channel_t **channels;  /* sorted unique channel set */
+    size_t unique_count;
+    pthread_mutex_t wait_mutex;
+    pthread_cond_t wait_cond;
+    conduit_select_waiter_t waiter;
+} conduit_prepared_select_t;
+
+static lean_external_class *g_prepared_select_class = NULL;
+
+static void conduit_prepared_select_finalizer(void *ptr) {
+    conduit_prepared_select_t *prep = (conduit_prepared_select_t *)ptr;
+    if (prep) {
+        pthread_cond_destroy(&prep->wait_cond);
+        pthread_mutex_destroy(&prep->wait_mutex);
+        free(prep->channels);
+        lean_dec(prep->cases_obj);
+        free(prep);
+    }
+}
+
+static void conduit_prepared_select_foreach(void *ptr, b_lean_obj_arg f) {
+    /* The retained case array (and through it the channels) is owned via
+     * cases_obj, but external objects do not participate in marking;
+     * the reference count taken at prepare time keeps it alive. */
+    (void)ptr;
+    (void)f;
+}
+
+static inline lean_obj_res conduit_prepared_select_box(conduit_prepared_select_t *prep) {
+    if (g_prepared_select_class == NULL) {
+        g_prepared_select_class = lean_register_external_class(
+            conduit_prepared_select_finalizer,
+            conduit_prepared_select_foreach
+        );
+    }
+    return lean_alloc_external(g_prepared_select_class, prep);
+}
+
+/*
+ * conduit_select_prepare : Array (Channel × Bool) → IO Prepared
+ *
+ * Build a reusable select set. Takes ownership of the case array.
+ */
+LEAN_EXPORT lean_obj_res conduit_select_prepare(
+    lean_obj_arg cases_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+
+    conduit_prepared_select_t *prep =
+        (conduit_prepared_select_t *)malloc(sizeof(conduit_prepared_select_t));
+    if (!prep) {
+        lean_dec(cases_obj);
+        return mk_io_error("failed to allocate prepared select");
+    }
+
+    size_t unique_count = 0;
+    conduit_channel_t **channels = NULL;
+    if (lean_array_size(cases_obj) > 0) {
+        channels = select_collect_channels(cases_obj, &unique_count);
+        if (!channels) {
+            free(prep);
+            lean_dec(cases_obj);
+            return mk_io_error("failed to allocate prepared select");
+        }
+    }
+
+    prep->cases_obj = cases_obj;
+    prep->channels = channels;
+    prep->unique_count = unique_count;
+    pthread_mutex_init(&prep->wait_mutex, NULL);
+    cond_init_monotonic(&prep->wait_cond);
+
+    return lean_io_result_mk_ok(conduit_prepared_select_box(prep));
+}
+
+/*
+ * conduit_select_prepared_wait : Prepared → Nat → IO (Option Nat)
+ *
+ * Wait on a prepared select set. timeout = 0 means wait forever.
+ * A prepared set holds a single waiter, so concurrent waits on the same
+ * handle are not supported; create one handle per waiting thread.
+ */
+LEAN_EXPORT lean_obj_res conduit_select_prepared_wait(
+    b_lean_obj_arg prep_obj,
+    b_lean_obj_arg timeout_obj,
+    lean_obj_arg world
+) {
+    conduit_prepared_select_t *prep =
+        (conduit_prepared_select_t *)lean_get_external_data(prep_obj);
+
+    if (lean_array_size(prep->cases_obj) == 0) {
+        return lean_io_result_mk_ok(lean_box(0)); /* none */
+    }
+
+    size_t timeout_ms = lean_usize_of_nat(timeout_obj);
+    return select_wait_core(prep->cases_obj, timeout_ms,
+                            prep->channels, prep->unique_count,
+                            &prep->wait_mutex, &prep->wait_cond,
+                            &prep->waiter, world);
+}
+
+/*
+ * conduit_select_prepared_poll : Prepared → IO (Option Nat)
+ *
+ * Non-blocking poll of a prepared select set.
+ */
+LEAN_EXPORT lean_obj_res conduit_select_prepared_poll(
+    b_lean_obj_arg prep_obj,
+    lean_obj_arg world
+) {
+    conduit_prepared_select_t *prep =
+        (conduit_prepared_select_t *)lean_get_external_data(prep_obj);
+    return conduit_select_poll(prep->cases_obj, world);
+}
+
+/*
+ * conduit_select_prepared_poll_all : Prepared → IO (Array Nat)
+ *
+ * Return every currently-ready index of a prepared select set in one sweep.
+ */
+LEAN_EXPORT lean_obj_res conduit_select_prepared_poll_all(
+    b_lean_obj_arg prep_obj,
+    lean_obj_arg world
+) {
+    conduit_prepared_select_t *prep =
+        (conduit_prepared_select_t *)lean_get_external_data(prep_obj);
+    return conduit_select_poll_all(prep->cases_obj, world);
+}
+
+/* ============================================================================
+ * conduit_channel_recv_any : Array (Channel α) → Nat → IO (Option (Nat × α))
+ *
+ * Receive one value from whichever input channel is ready, blocking until a
+ * value arrives or every input is closed and drained. The take pass rotates
+ * starting at start % n so a busy early channel cannot starve later ones.
+ * Returns none once all inputs are exhausted (or the task is canceled).
+ *
+ * This is the engine behind Channel.merge: one consumer registers as a
+ * select waiter on every input instead of dedicating a thread per input.
+ * ============================================================================ */
+
+/* Take one value without blocking. Returns 0 = ok (*out set),
+ * 1 = nothing available (channel open), 2 = closed and drained. */
+static int channel_take(conduit_channel_t *ch, lean_object **out) {
+    if (channel_is_fast(ch)) {
+        if (fast_try_recv(ch, out) == 0) {
+            lf_wake(ch, false);
+            return 0;
+        }
+        if (atomic_load_explicit(&ch->lf_closed, memory_order_acquire)) {
+            /* Re-check: a value may have been enqueued before close won */
+            if (fast_try_recv(ch, out) == 0) {
+                lf_wake(ch, false);
+                return 0;
+            }
+            return 2;
+        }
+        return 1;
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->unbounded) {
+        if (ch->count > 0) {
+            *out = unbounded_pop(ch);
+            if (ch->stats) {
+                stats_count(&ch->stats->recvs, 1);
+            }
+            pthread_mutex_unlock(&ch->mutex);
+            return 0;
+        }
+        int rc = ch->closed ? 2 : 1;
+        pthread_mutex_unlock(&ch->mutex);
+        return rc;
+    }
+
+    if (ch->capacity == 0) {
+        /* Unbuffered: take the pending handoff if one is offered */
+        if (ch->pending_ready && !ch->pending_taken) {
+            *out = ch->pending_value;
+            ch->pending_taken = true;
+            ch->pending_ready = false;
+            handoff_publish(ch);
+            if (ch->stats) {
+                stats_count(&ch->stats->recvs, 1);
+            }
+            pthread_cond_signal(&ch->not_full);
+            select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+            pthread_mutex_unlock(&ch->mutex);
+            return 0;
+        }
+        int rc = ch->closed ? 2 : 1;
+        pthread_mutex_unlock(&ch->mutex);
+        return rc;
+    }
+
+    if (queued_total(ch) > 0) {
+        *out = channel_pop_locked(ch);
+        buffer_maybe_shrink(ch);
+        if (ch->stats) {
+            stats_count(&ch->stats->recvs, 1);
+        }
+        pthread_cond_signal(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_SEND_READY);
+        pthread_mutex_unlock(&ch->mutex);
+        return 0;
+    }
+    int rc = ch->closed ? 2 : 1;
+    pthread_mutex_unlock(&ch->mutex);
+    return rc;
+}
+
+LEAN_EXPORT lean_obj_res conduit_channel_recv_any(
+    b_lean_obj_arg chs_obj,
+    b_lean_obj_arg start_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    size_t n = lean_array_size(chs_obj);
+    if (n == 0) {
+        return lean_io_result_mk_ok(lean_box(0)); /* none */
+    }
+    size_t start = lean_usize_of_nat(start_obj) % n;
+
+    /* Recv-shaped case array so waiter eligibility and wake-one notification
+     * see the same layout select uses. */
+    lean_object *cases_obj = lean_alloc_array(n, n);
+    for (size_t i = 0; i < n; i++) {
+        lean_object *ch_obj = lean_array_get_core(chs_obj, i);
+        lean_inc(ch_obj);
+        lean_object *pair = lean_alloc_ctor(0, 2, 0);
+        lean_ctor_set(pair, 0, ch_obj);
+        lean_ctor_set(pair, 1, lean_box(0)); /* is_send = false */
+        lean_array_set_core(cases_obj, i, pair);
+    }
+
+    size_t unique_count = 0;
+    conduit_channel_t **channels = select_collect_channels(cases_obj, &unique_count);
+    if (!channels) {
+        lean_dec(cases_obj);
+        return lean_io_result_mk_ok(lean_box(0)); /* none on alloc failure */
+    }
+
+    /* Per unique channel: the take pass saw it closed and drained. Such a
+     * channel must not count as ready in the re-check below, or the loop
+     * spins without sleeping from the first input close to the last. */
+    bool *seen_closed = (bool *)malloc(unique_count * sizeof(bool));
+    if (!seen_closed) {
+        free(channels);
+        lean_dec(cases_obj);
+        return lean_io_result_mk_ok(lean_box(0)); /* none on alloc failure */
+    }
+
+    pthread_mutex_t wait_mutex;
+    pthread_cond_t wait_cond;
+    pthread_mutex_init(&wait_mutex, NULL);
+    cond_init_monotonic(&wait_cond);
+    conduit_select_waiter_t waiter;
+
+    lean_object *result = NULL;
+
+    for (;;) {
+        /* 1. Rotating take pass: consume directly, so readiness cannot be
+         * stolen between a poll and a separate receive. */
+        size_t open_count = 0;
+        memset(seen_closed, 0, unique_count * sizeof(bool));
+        for (size_t k = 0; k < n; k++) {
+            size_t i = (start + k) % n;
+            conduit_channel_t *ch =
+                conduit_channel_unbox(lean_array_get_core(chs_obj, i));
+            lean_object *value;
+            int rc = channel_take(ch, &value);
+            if (rc == 0) {
+                lean_object *pair = lean_alloc_ctor(0, 2, 0);
+                lean_ctor_set(pair, 0, lean_usize_to_nat(i));
+                lean_ctor_set(pair, 1, value);
+                result = lean_alloc_ctor(1, 1, 0);
+                lean_ctor_set(result, 0, pair);
+                goto done;
+            }
+            if (rc == 1) {
+                open_count++;
+            } else {
+                /* Closed and drained; channels[] is sorted, n is small */
+                for (size_t u = 0; u < unique_count; u++) {
+                    if (channels[u] == ch) {
+                        seen_closed[u] = true;
+                        break;
+                    }
+                }
+            }
+        }
+        if (open_count == 0) {
+            result = lean_box(0); /* all inputs closed and drained */
+            goto done;
+        }
+
+        /* 2. Nothing ready: register as a waiter on every input and sleep
+         * until a send, a close, or a cancellation kick arrives. */
+        waiter.cond = &wait_cond;
+        waiter.mutex = &wait_mutex;
+        waiter.notified = false;
+        waiter.next = NULL;
+        waiter.cases = cases_obj;
+        waiter.ready_ch = NULL;
+
+        for (size_t i = 0; i < unique_count; i++) {
+            pthread_mutex_lock(&channels[i]->mutex);
+            select_register_waiter(channels[i], &waiter);
+        }
+
+        /* Re-check under the locks so a send between the take pass and
+         * registration cannot be missed. channel_ready would report a
+         * closed-and-drained input as recv-ready even though the take
+         * pass can never take from it; count a channel only for
+         * deliverable data, or for a close that arrived after the take
+         * pass saw it open (so the next pass re-counts open inputs). */
+        bool found_ready = false;
+        for (size_t i = 0; i < unique_count && !found_ready; i++) {
+            conduit_channel_t *ch = channels[i];
+            bool closed_now = channel_is_fast(ch)
+                ? atomic_load_explicit(&ch->lf_closed, memory_order_acquire)
+                : ch->closed;
+            found_ready = channel_recv_has_data(ch)
+                || (closed_now && !seen_closed[i]);
+        }
+
+        bool canceled = false;
+        if (found_ready) {
+            for (size_t i = unique_count; i > 0; i--) {
+                select_unregister_waiter(channels[i-1], &waiter);
+                pthread_mutex_unlock(&channels[i-1]->mutex);
+            }
+        } else {
+            pthread_mutex_lock(&wait_mutex);
+            for (size_t i = unique_count; i > 0; i--) {
+                pthread_mutex_unlock(&channels[i-1]->mutex);
+            }
+            while (!waiter.notified) {
+                if (cond_wait_interruptible(&wait_cond, &wait_mutex) == ECANCELED) {
+                    canceled = true;
+                    break;
+                }
+            }
+            pthread_mutex_unlock(&wait_mutex);
+
+            for (size_t i = 0; i < unique_count; i++) {
+                pthread_mutex_lock(&channels[i]->mutex);
+                select_unregister_waiter(channels[i], &waiter);
+                pthread_mutex_unlock(&channels[i]->mutex);
+            }
+        }
+
+        if (canceled) {
+            result = lean_box(0); /* canceled - behave as closed */
+            goto done;
+        }
+    }
+
+done:
+    pthread_cond_destroy(&wait_cond);
+    pthread_mutex_destroy(&wait_mutex);
+    free(seen_closed);
+    free(channels);
+    lean_dec(cases_obj);
+    return lean_io_result_mk_ok(result);
+}
+
+/* ============================================================================
+ * conduit_broadcast_send : Array (Channel α) → α → IO (Array Nat)
+ *
+ * One-call fan-out for broadcast distributors. Takes one reference per
+ * subscriber up front (n-1 increments beyond the one the call owns), then
+ * appends the value into every open subscriber ring while holding each lock
+ * only for the append. Surplus references are released as closed or full
+ * subscribers are skipped.
+ *
+ * Returns the indices of subscribers that were full (or unbuffered, whose
+ * handoff needs a blocking send), in order; callers fall back to send for
+ * those, preserving backpressure semantics.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_broadcast_send(
+    b_lean_obj_arg subs_obj,
+    lean_obj_arg value,
+    lean_obj_arg world
+) {
+    (void)world;
+    size_t n = lean_array_size(subs_obj);
+    if (n == 0) {
+        lean_dec(value);
+        return lean_io_result_mk_ok(lean_mk_empty_array());
+    }
+
+    /* One reference per subscriber; holding them until each store keeps the
+     * pointer valid even if an early subscriber consumes its copy at once. */
+    for (size_t i = 1; i < n; i++) {
+        lean_inc(value);
+    }
+
+    lean_object *full = lean_mk_empty_array();
+
+    for (size_t i = 0; i < n; i++) {
+        conduit_channel_t *ch =
+            conduit_channel_unbox(lean_array_get_core(subs_obj, i));
+
+        if (channel_is_fast(ch)) {
+            int rc = fast_try_send(ch, value);
+            if (rc == 0) {
+                lf_wake(ch, true);
+            } else {
+                lean_dec(value);
+                if (rc == 1) {
+                    full = lean_array_push(full, lean_usize_to_nat(i));
+                }
+            }
+            continue;
+        }
+
+        pthread_mutex_lock(&ch->mutex);
+
+        if (ch->closed) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            continue;
+        }
+
+        if (ch->unbounded) {
+            if (unbounded_push(ch, value)) {
+                if (ch->stats) {
+                    stats_count(&ch->stats->sends, 1);
+                    stats_high_water(ch->stats, ch->count);
+                }
+                pthread_cond_signal(&ch->not_empty);
+                select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+                pthread_mutex_unlock(&ch->mutex);
+            } else {
+                pthread_mutex_unlock(&ch->mutex);
+                lean_dec(value); /* allocation failure: treat as full */
+                full = lean_array_push(full, lean_usize_to_nat(i));
+            }
+            continue;
+        }
+
+        if (ch->capacity > 0 && ch->count < ch->capacity) {
+            if (!buffer_reserve(ch, ch->count + 1)) {
+                pthread_mutex_unlock(&ch->mutex);
+                lean_dec(value); /* allocation failure: treat as full */
+                full = lean_array_push(full, lean_usize_to_nat(i));
+                continue;
+            }
+            ch->buffer[ch->tail] = value;
+            ch->tail = (ch->tail + 1) % ch->buf_cap;
+            ch->count++;
+            depth_publish(ch);
+            if (ch->stats) {
+                stats_count(&ch->stats->sends, 1);
+                stats_high_water(ch->stats, ch->count);
+            }
+            pthread_cond_signal(&ch->not_empty);
+            select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+            pthread_mutex_unlock(&ch->mutex);
+            continue;
+        }
+
+        /* Full ring, or unbuffered (handoff needs a blocking send) */
+        pthread_mutex_unlock(&ch->mutex);
+        lean_dec(value);
+        full = lean_array_push(full, lean_usize_to_nat(i));
+    }
+
+    return lean_io_result_mk_ok(full);
+}
+
+/* ============================================================================
+ * conduit_channel_send_overwrite : Channel α → α → IO Bool
+ *
+ * Overwrite-on-full send for lossy subscribers: never blocks. When the ring
+ * is full the oldest buffered value is evicted (its reference released) to
+ * make room, so the newest data always wins; a capacity-1 ring degenerates
+ * to a latest-value conflation slot. Evictions are counted in the channel's
+ * dropped counter. On an unbuffered channel there is nothing to overwrite,
+ * so the value itself is discarded and counted.
+ * Returns false only if the channel is closed.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_send_overwrite(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg value,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    if (channel_is_fast(ch)) {
+        /* Lock-free ring: evict through the consumer side until the
+         * enqueue succeeds. */
+        for (;;) {
+            int rc = fast_try_send(ch, value);
+            if (rc == 0) {
+                lf_wake(ch, true);
+                hw_check_after_send(ch);
+                return lean_io_result_mk_ok(lean_box(1)); /* true */
+            }
+            if (rc == 2) {
+                lean_dec(value);
+                return lean_io_result_mk_ok(lean_box(0)); /* false */
+            }
+            lean_object *old;
+            if (fast_try_recv(ch, &old) == 0) {
+                lean_dec(old);
+                atomic_fetch_add_explicit(&ch->dropped, 1, memory_order_relaxed);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        lean_dec(value);
+        return lean_io_result_mk_ok(lean_box(0)); /* false */
+    }
+
+    if (ch->unbounded) {
+        /* Never full; same as a plain send */
+        if (!unbounded_push(ch, value)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("failed to allocate channel segment");
+        }
+    } else if (ch->capacity == 0) {
+        /* Unbuffered: nothing to overwrite; discard and count */
+        pthread_mutex_unlock(&ch->mutex);
+        lean_dec(value);
+        atomic_fetch_add_explicit(&ch->dropped, 1, memory_order_relaxed);
+        return lean_io_result_mk_ok(lean_box(1)); /* true */
+    } else {
+        if (ch->count >= ch->capacity) {
+            /* Evict the oldest value to make room */
+            lean_object *old = ch->buffer[ch->head];
+            ch->buffer[ch->head] = NULL;
+            ch->head = (ch->head + 1) % ch->buf_cap;
+            ch->count--;
+            lean_dec(old);
+            atomic_fetch_add_explicit(&ch->dropped, 1, memory_order_relaxed);
+        }
+        if (!buffer_reserve(ch, ch->count + 1)) {
+            pthread_mutex_unlock(&ch->mutex);
+            lean_dec(value);
+            return mk_io_error("failed to allocate channel buffer");
+        }
+        ch->buffer[ch->tail] = value;
+        ch->tail = (ch->tail + 1) % ch->buf_cap;
+        ch->count++;
+        depth_publish(ch);
+    }
+
+    if (ch->stats) {
+        stats_count(&ch->stats->sends, 1);
+        stats_high_water(ch->stats, ch->count);
+    }
+
+    pthread_cond_signal(&ch->not_empty);
+    select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
+
+    pthread_mutex_unlock(&ch->mutex);
+    hw_check_after_send(ch);
+    return lean_io_result_mk_ok(lean_box(1)); /* true */
+}
+
+/* ============================================================================
+ * conduit_channel_dropped : Channel α → IO Nat
+ *
+ * Number of values evicted or discarded by overwrite-on-full sends.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_dropped(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    uint64_t dropped = atomic_load_explicit(&ch->dropped, memory_order_relaxed);
+    return lean_io_result_mk_ok(lean_uint64_to_nat(dropped));
+}
+
+/* ============================================================================
+ * conduit_channel_on_high_water : Channel α → Nat → IO Unit → IO Unit
+ *
+ * Register an edge-triggered high-water callback: the handler fires (on
+ * the sending thread, outside the channel lock) once when depth reaches
+ * threshold, and fires again only after depth has dropped back under the
+ * threshold. A threshold of 0 is treated as 1. Registering replaces any
+ * previous handler; the handler is retained until the channel is
+ * finalized or replaced.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_channel_on_high_water(
+    b_lean_obj_arg ch_obj,
+    b_lean_obj_arg threshold_obj,
+    lean_obj_arg handler,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+
+    size_t threshold = lean_usize_of_nat(threshold_obj);
+    if (threshold == 0) {
+        threshold = 1; /* Crossing zero is meaningless */
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+    lean_object *old =
+        atomic_load_explicit(&ch->hw_handler, memory_order_relaxed);
+    ch->hw_threshold = threshold;
+    atomic_store_explicit(&ch->hw_handler, handler, memory_order_release);
+    /* Arm immediately: if depth is already at the threshold the next send
+     * fires, otherwise the first crossing does. */
+    atomic_store_explicit(&ch->hw_armed, true, memory_order_release);
+    pthread_mutex_unlock(&ch->mutex);
+
+    if (old) {
+        lean_dec(old);
+    }
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/* ============================================================================
+ * conduit_wake_blocked : IO Unit
+ *
+ * Wake every thread blocked in a channel operation so it can re-check its
+ * task's cancellation flag. Canceled operations complete as if the channel
+ * were closed. Used by Conduit.cancel after IO.cancel sets the flag.
+ * ============================================================================ */
+
+LEAN_EXPORT lean_obj_res conduit_wake_blocked(lean_obj_arg world) {
+    (void)world;
+    pthread_mutex_lock(&g_channels_mutex);
+    for (conduit_channel_t *ch = g_channels; ch != NULL; ch = ch->reg_next) {
+        pthread_mutex_lock(&ch->mutex);
+        pthread_cond_broadcast(&ch->not_empty);
+        pthread_cond_broadcast(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_ANY);
+        pthread_mutex_unlock(&ch->mutex);
+    }
+    pthread_mutex_unlock(&g_channels_mutex);
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/* ============================================================================
+ * Allocation Statistics (for testing finalizers and memory leaks)
+ * ============================================================================ */
+
+/*
+ * conduit_get_alloc_stats : IO (Int × Int)
+ *
+ * Returns (alloc_count, free_count) for testing that finalizers run correctly.
+ */
+LEAN_EXPORT lean_obj_res conduit_get_alloc_stats(lean_obj_arg world) {
+    (void)world;
+    int64_t allocs = atomic_load(&g_channel_alloc_count);
+    int64_t frees = atomic_load(&g_channel_free_count);
+    /* Return tuple (allocs, frees) as (Nat, Nat) */
+    lean_object *pair = lean_alloc_ctor(0, 2, 0);
+    lean_ctor_set(pair, 0, lean_uint64_to_nat((uint64_t)allocs));
+    lean_ctor_set(pair, 1, lean_uint64_to_nat((uint64_t)frees));
+    return lean_io_result_mk_ok(pair);
+}
+
+/*
+ * conduit_reset_alloc_stats : IO Unit
+ *
+ * Resets allocation counters to zero (useful between tests).
+ */
+LEAN_EXPORT lean_obj_res conduit_reset_alloc_stats(lean_obj_arg world) {
+    (void)world;
+    atomic_store(&g_channel_alloc_count, 0);
+    atomic_store(&g_channel_free_count, 0);
+    atomic_store(&g_channel_pool_hits, 0);
+    atomic_store(&g_channel_cold_allocs, 0);
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/*
+ * conduit_get_pool_stats : IO (Nat × Nat)
+ *
+ * Returns (pool_hits, cold_allocs): how many channel creations were served
+ * by the free-list pool versus a cold malloc + primitive init.
+ */
+LEAN_EXPORT lean_obj_res conduit_get_pool_stats(lean_obj_arg world) {
+    (void)world;
+    int64_t hits = atomic_load(&g_channel_pool_hits);
+    int64_t cold = atomic_load(&g_channel_cold_allocs);
+    lean_object *pair = lean_alloc_ctor(0, 2, 0);
+    lean_ctor_set(pair, 0, lean_uint64_to_nat((uint64_t)hits));
+    lean_ctor_set(pair, 1, lean_uint64_to_nat((uint64_t)cold));
+    return lean_io_result_mk_ok(pair);
+}
+
+/* ============================================================================
+ * Telemetry Exports
+ *
+ * The latency histograms accumulated by the TELEM_* hooks (see the
+ * Operation Latency Telemetry section). Always linked so Lean code runs
+ * unchanged against any build: without CONDUIT_FFI_TELEMETRY the toggle
+ * is inert and snapshots report zeros.
+ * ============================================================================ */
+
+/*
+ * conduit_telemetry_set_enabled : Bool → IO Unit
+ *
+ * Process-wide runtime toggle for latency recording.
+ */
+LEAN_EXPORT lean_obj_res conduit_telemetry_set_enabled(
+    uint8_t on,
+    lean_obj_arg world
+) {
+    (void)world;
+#ifdef CONDUIT_FFI_TELEMETRY
+    atomic_store_explicit(&g_telemetry_enabled, on != 0, memory_order_relaxed);
+#else
+    (void)on;
+#endif
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/*
+ * conduit_telemetry_enabled : IO Bool
+ *
+ * True only in an instrumented build with the runtime toggle on.
+ */
+LEAN_EXPORT lean_obj_res conduit_telemetry_enabled(lean_obj_arg world) {
+    (void)world;
+#ifdef CONDUIT_FFI_TELEMETRY
+    bool on = atomic_load_explicit(&g_telemetry_enabled, memory_order_relaxed);
+    return lean_io_result_mk_ok(lean_box(on ? 1 : 0));
+#else
+    return lean_io_result_mk_ok(lean_box(0));
+#endif
+}
+
+/*
+ * conduit_telemetry_op_snapshot : UInt8 → IO (Array Nat)
+ *
+ * Merge one operation's histogram across all thread blocks. Layout:
+ * [count, totalNanos, maxNanos, bucket0 .. bucket63] where bucket i
+ * counts latencies in [2^i, 2^(i+1)) nanoseconds.
+ */
+LEAN_EXPORT lean_obj_res conduit_telemetry_op_snapshot(
+    uint8_t op,
+    lean_obj_arg world
+) {
+    (void)world;
+    uint64_t count = 0, total = 0, max = 0;
+    uint64_t buckets[TELEM_BUCKETS] = {0};
+
+#ifdef CONDUIT_FFI_TELEMETRY
+    if (op < TELEM_OP_COUNT) {
+        pthread_mutex_lock(&g_telem_mutex);
+        for (conduit_telem_block_t *b = g_telem_blocks; b; b = b->next) {
+            count += atomic_load_explicit(&b->count[op], memory_order_relaxed);
+            total += atomic_load_explicit(&b->total_ns[op], memory_order_relaxed);
+            uint64_t m = atomic_load_explicit(&b->max_ns[op], memory_order_relaxed);
+            if (m > max) {
+                max = m;
+            }
+            for (int i = 0; i < TELEM_BUCKETS; i++) {
+                buckets[i] += atomic_load_explicit(&b->buckets[op][i],
+                                                   memory_order_relaxed);
+            }
+        }
+        pthread_mutex_unlock(&g_telem_mutex);
+    }
+#else
+    (void)op;
+#endif
+
+    size_t len = 3 + TELEM_BUCKETS;
+    lean_object *arr = lean_alloc_array(len, len);
+    lean_array_set_core(arr, 0, lean_uint64_to_nat(count));
+    lean_array_set_core(arr, 1, lean_uint64_to_nat(total));
+    lean_array_set_core(arr, 2, lean_uint64_to_nat(max));
+    for (int i = 0; i < TELEM_BUCKETS; i++) {
+        lean_array_set_core(arr, 3 + (size_t)i, lean_uint64_to_nat(buckets[i]));
+    }
+    return lean_io_result_mk_ok(arr);
+}
+
+/*
+ * conduit_telemetry_reset : IO Unit
+ *
+ * Zero every thread block. Racy against in-flight recordings (a sample
+ * may straddle the reset); acceptable for a monitoring surface.
+ */
+LEAN_EXPORT lean_obj_res conduit_telemetry_reset(lean_obj_arg world) {
+    (void)world;
+#ifdef CONDUIT_FFI_TELEMETRY
+    pthread_mutex_lock(&g_telem_mutex);
+    for (conduit_telem_block_t *b = g_telem_blocks; b; b = b->next) {
+        for (int op = 0; op < TELEM_OP_COUNT; op++) {
+            atomic_store_explicit(&b->count[op], 0, memory_order_relaxed);
+            atomic_store_explicit(&b->total_ns[op], 0, memory_order_relaxed);
+            atomic_store_explicit(&b->max_ns[op], 0, memory_order_relaxed);
+            for (int i = 0; i < TELEM_BUCKETS; i++) {
+                atomic_store_explicit(&b->buckets[op][i], 0, memory_order_relaxed);
+            }
+        }
+    }
+    pthread_mutex_unlock(&g_telem_mutex);
+#endif
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/* ============================================================================
+ * Scalar Channels (unboxed UInt64/Float payloads)
+ *
+ * Specialized buffered channels whose ring is a flat uint64_t array
+ * instead of lean_object pointers: no allocation per message and a
+ * cache-friendly buffer. Float values travel as their IEEE-754 bit
+ * pattern through the same machinery. Scalar channels are always
+ * buffered and do not participate in select.
+ * ============================================================================ */
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+
+    uint64_t *buffer;             /* Flat circular buffer */
+    size_t capacity;
+    size_t head;
+    size_t tail;
+    size_t count;
+
+    bool closed;
+} conduit_scalar_channel_t;
+
+static lean_external_class *g_scalar_channel_class = NULL;
+
+static void conduit_scalar_channel_finalizer(void *ptr) {
+    conduit_scalar_channel_t *ch = (conduit_scalar_channel_t *)ptr;
+    if (ch) {
+        atomic_fetch_add(&g_channel_free_count, 1);
+        pthread_mutex_destroy(&ch->mutex);
+        pthread_cond_destroy(&ch->not_empty);
+        pthread_cond_destroy(&ch->not_full);
+        free(ch->buffer);
+        free(ch);
+    }
+}
+
+static void conduit_scalar_channel_foreach(void *ptr, b_lean_obj_arg f) {
+    /* Scalar payloads hold no Lean objects */
+    (void)ptr;
+    (void)f;
+}
+
+static inline lean_obj_res conduit_scalar_channel_box(conduit_scalar_channel_t *ch) {
+    if (g_scalar_channel_class == NULL) {
+        g_scalar_channel_class = lean_register_external_class(
+            conduit_scalar_channel_finalizer,
+            conduit_scalar_channel_foreach
+        );
+    }
+    return lean_alloc_external(g_scalar_channel_class, ch);
+}
+
+static inline conduit_scalar_channel_t *conduit_scalar_channel_unbox(b_lean_obj_arg obj) {
+    return (conduit_scalar_channel_t *)lean_get_external_data(obj);
+}
+
+/* Shared constructor; capacity 0 is clamped to 1 (always buffered). */
+static lean_obj_res scalar_channel_new(size_t capacity) {
+    if (capacity == 0) {
+        capacity = 1;
+    }
+
+    conduit_scalar_channel_t *ch =
+        (conduit_scalar_channel_t *)malloc(sizeof(conduit_scalar_channel_t));
+    if (!ch) {
+        return mk_io_error("Failed to allocate channel");
+    }
+
+    ch->buffer = (uint64_t *)calloc(capacity, sizeof(uint64_t));
+    if (!ch->buffer) {
+        free(ch);
+        return mk_io_error("Failed to allocate channel buffer");
+    }
+
+    if (pthread_mutex_init(&ch->mutex, NULL) != 0) {
+        free(ch->buffer);
+        free(ch);
+        return mk_io_error("Failed to initialize mutex");
+    }
+
+    if (cond_init_monotonic(&ch->not_empty) != 0) {
+        pthread_mutex_destroy(&ch->mutex);
+        free(ch->buffer);
+        free(ch);
+        return mk_io_error("Failed to initialize condition variable");
+    }
+
+    if (cond_init_monotonic(&ch->not_full) != 0) {
+        pthread_cond_destroy(&ch->not_empty);
+        pthread_mutex_destroy(&ch->mutex);
+        free(ch->buffer);
+        free(ch);
+        return mk_io_error("Failed to initialize condition variable");
+    }
+
+    ch->capacity = capacity;
+    ch->head = 0;
+    ch->tail = 0;
+    ch->count = 0;
+    ch->closed = false;
+
+    atomic_fetch_add(&g_channel_alloc_count, 1);
+    return lean_io_result_mk_ok(conduit_scalar_channel_box(ch));
+}
+
+/* Blocking send of one scalar. Returns true if sent, false if closed. */
+static bool scalar_channel_send(conduit_scalar_channel_t *ch, uint64_t bits) {
+    pthread_mutex_lock(&ch->mutex);
+
+    while (ch->count >= ch->capacity && !ch->closed) {
+        if (cond_wait_interruptible(&ch->not_full, &ch->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&ch->mutex);
+            return false;
+        }
+    }
+
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        return false;
+    }
+
+    ch->buffer[ch->tail] = bits;
+    ch->tail = (ch->tail + 1) % ch->capacity;
+    ch->count++;
+
+    pthread_cond_signal(&ch->not_empty);
+    pthread_mutex_unlock(&ch->mutex);
+    return true;
+}
+
+/* Blocking receive of one scalar. Returns true if *out was filled,
+ * false if the channel is closed and drained. */
+static bool scalar_channel_recv(conduit_scalar_channel_t *ch, uint64_t *out) {
+    pthread_mutex_lock(&ch->mutex);
+
+    while (ch->count == 0 && !ch->closed) {
+        if (cond_wait_interruptible(&ch->not_empty, &ch->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&ch->mutex);
+            return false;
+        }
+    }
+
+    if (ch->count == 0) {
+        pthread_mutex_unlock(&ch->mutex);
+        return false;
+    }
+
+    *out = ch->buffer[ch->head];
+    ch->head = (ch->head + 1) % ch->capacity;
+    ch->count--;
+
+    pthread_cond_signal(&ch->not_full);
+    pthread_mutex_unlock(&ch->mutex);
+    return true;
+}
+
+/* Non-blocking send. Returns 0 = ok, 1 = would block, 2 = closed. */
+static int scalar_channel_try_send(conduit_scalar_channel_t *ch, uint64_t bits) {
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        return 2;
+    }
+    if (ch->count >= ch->capacity) {
+        pthread_mutex_unlock(&ch->mutex);
+        return 1;
+    }
+
+    ch->buffer[ch->tail] = bits;
+    ch->tail = (ch->tail + 1) % ch->capacity;
+    ch->count++;
+
+    pthread_cond_signal(&ch->not_empty);
+    pthread_mutex_unlock(&ch->mutex);
+    return 0;
+}
+
+/* Non-blocking receive. Returns 0 = ok (*out set), 1 = empty, 2 = closed. */
+static int scalar_channel_try_recv(conduit_scalar_channel_t *ch, uint64_t *out) {
+    pthread_mutex_lock(&ch->mutex);
+
+    if (ch->count == 0) {
+        int rc = ch->closed ? 2 : 1;
+        pthread_mutex_unlock(&ch->mutex);
+        return rc;
+    }
+
+    *out = ch->buffer[ch->head];
+    ch->head = (ch->head + 1) % ch->capacity;
+    ch->count--;
+
+    pthread_cond_signal(&ch->not_full);
+    pthread_mutex_unlock(&ch->mutex);
+    return 0;
+}
+
+static void scalar_channel_close(conduit_scalar_channel_t *ch) {
+    pthread_mutex_lock(&ch->mutex);
+    if (!ch->closed) {
+        ch->closed = true;
+        pthread_cond_broadcast(&ch->not_empty);
+        pthread_cond_broadcast(&ch->not_full);
+    }
+    pthread_mutex_unlock(&ch->mutex);
+}
+
+/* ---- UInt64 channel entry points ---- */
+
+LEAN_EXPORT lean_obj_res conduit_u64_channel_new(
+    b_lean_obj_arg capacity_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    return scalar_channel_new(lean_usize_of_nat(capacity_obj));
+}
+
+LEAN_EXPORT lean_obj_res conduit_u64_channel_send(
+    b_lean_obj_arg ch_obj,
+    uint64_t value,
+    lean_obj_arg world
+) {
+    (void)world;
+    bool sent = scalar_channel_send(conduit_scalar_channel_unbox(ch_obj), value);
+    return lean_io_result_mk_ok(lean_box(sent ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_u64_channel_recv(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    uint64_t value;
+    if (scalar_channel_recv(conduit_scalar_channel_unbox(ch_obj), &value)) {
+        lean_object *some = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(some, 0, lean_box_uint64(value));
+        return lean_io_result_mk_ok(some);
+    }
+    return lean_io_result_mk_ok(lean_box(0)); /* none */
+}
+
+LEAN_EXPORT lean_obj_res conduit_u64_channel_try_send(
+    b_lean_obj_arg ch_obj,
+    uint64_t value,
+    lean_obj_arg world
+) {
+    (void)world;
+    int rc = scalar_channel_try_send(conduit_scalar_channel_unbox(ch_obj), value);
+    return lean_io_result_mk_ok(lean_box((size_t)rc));
+}
+
+LEAN_EXPORT lean_obj_res conduit_u64_channel_try_recv(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    uint64_t value;
+    int rc = scalar_channel_try_recv(conduit_scalar_channel_unbox(ch_obj), &value);
+    if (rc == 0) {
+        lean_object *result = lean_alloc_ctor(0, 1, 0); /* .ok value */
+        lean_ctor_set(result, 0, lean_box_uint64(value));
+        return lean_io_result_mk_ok(result);
+    }
+    /* .empty (1) or .closed (2) */
+    return lean_io_result_mk_ok(lean_alloc_ctor(rc == 1 ? 1 : 2, 0, 0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_scalar_channel_close(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    scalar_channel_close(conduit_scalar_channel_unbox(ch_obj));
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_scalar_channel_is_closed(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_scalar_channel_t *ch = conduit_scalar_channel_unbox(ch_obj);
+    pthread_mutex_lock(&ch->mutex);
+    bool closed = ch->closed;
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(lean_box(closed ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_scalar_channel_len(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_scalar_channel_t *ch = conduit_scalar_channel_unbox(ch_obj);
+    pthread_mutex_lock(&ch->mutex);
+    size_t len = ch->count;
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(lean_usize_to_nat(len));
+}
+
+LEAN_EXPORT lean_obj_res conduit_scalar_channel_capacity(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_scalar_channel_t *ch = conduit_scalar_channel_unbox(ch_obj);
+    /* Capacity is immutable, no lock needed */
+    return lean_io_result_mk_ok(lean_usize_to_nat(ch->capacity));
+}
+
+/* ---- Float channel entry points (IEEE-754 bits through the u64 ring) ---- */
+
+static inline uint64_t float_to_bits(double v) {
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+static inline double bits_to_float(uint64_t bits) {
+    double v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+LEAN_EXPORT lean_obj_res conduit_f64_channel_new(
+    b_lean_obj_arg capacity_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    return scalar_channel_new(lean_usize_of_nat(capacity_obj));
+}
+
+LEAN_EXPORT lean_obj_res conduit_f64_channel_send(
+    b_lean_obj_arg ch_obj,
+    double value,
+    lean_obj_arg world
+) {
+    (void)world;
+    bool sent = scalar_channel_send(conduit_scalar_channel_unbox(ch_obj),
+                                    float_to_bits(value));
+    return lean_io_result_mk_ok(lean_box(sent ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_f64_channel_recv(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    uint64_t bits;
+    if (scalar_channel_recv(conduit_scalar_channel_unbox(ch_obj), &bits)) {
+        lean_object *some = lean_alloc_ctor(1, 1, 0);
+        lean_ctor_set(some, 0, lean_box_float(bits_to_float(bits)));
+        return lean_io_result_mk_ok(some);
+    }
+    return lean_io_result_mk_ok(lean_box(0)); /* none */
+}
+
+LEAN_EXPORT lean_obj_res conduit_f64_channel_try_send(
+    b_lean_obj_arg ch_obj,
+    double value,
+    lean_obj_arg world
+) {
+    (void)world;
+    int rc = scalar_channel_try_send(conduit_scalar_channel_unbox(ch_obj),
+                                     float_to_bits(value));
+    return lean_io_result_mk_ok(lean_box((size_t)rc));
+}
+
+LEAN_EXPORT lean_obj_res conduit_f64_channel_try_recv(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    uint64_t bits;
+    int rc = scalar_channel_try_recv(conduit_scalar_channel_unbox(ch_obj), &bits);
+    if (rc == 0) {
+        lean_object *result = lean_alloc_ctor(0, 1, 0); /* .ok value */
+        lean_ctor_set(result, 0, lean_box_float(bits_to_float(bits)));
+        return lean_io_result_mk_ok(result);
+    }
+    return lean_io_result_mk_ok(lean_alloc_ctor(rc == 1 ? 1 : 2, 0, 0));
+}
+
+/* ============================================================================
+ * Byte-Stream Channel (contiguous byte ring)
+ *
+ * Bulk binary transport between reader and parser stages. Instead of one
+ * boxed ByteArray object per chunk through a pointer ring, bytes are
+ * memcpy'd directly into a contiguous ring under one lock, so chunk
+ * boundaries disappear and backpressure is expressed in bytes rather than
+ * message counts. Reads and writes follow read(2)/write(2) semantics:
+ * block until at least one byte (of data / of space) is available, then
+ * transfer as much as fits in one go.
+ * ============================================================================ */
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+
+    uint8_t *buffer;              /* Contiguous byte ring */
+    size_t capacity;
+    size_t head;
+    size_t tail;
+    size_t count;
+
+    bool closed;
+} conduit_bytes_channel_t;
+
+static lean_external_class *g_bytes_channel_class = NULL;
+
+static void conduit_bytes_channel_finalizer(void *ptr) {
+    conduit_bytes_channel_t *ch = (conduit_bytes_channel_t *)ptr;
+    if (ch) {
+        atomic_fetch_add(&g_channel_free_count, 1);
+        pthread_mutex_destroy(&ch->mutex);
+        pthread_cond_destroy(&ch->not_empty);
+        pthread_cond_destroy(&ch->not_full);
+        free(ch->buffer);
+        free(ch);
+    }
+}
+
+static void conduit_bytes_channel_foreach(void *ptr, b_lean_obj_arg f) {
+    /* Raw bytes hold no Lean objects */
+    (void)ptr;
+    (void)f;
+}
+
+static inline lean_obj_res conduit_bytes_channel_box(conduit_bytes_channel_t *ch) {
+    if (g_bytes_channel_class == NULL) {
+        g_bytes_channel_class = lean_register_external_class(
+            conduit_bytes_channel_finalizer,
+            conduit_bytes_channel_foreach
+        );
+    }
+    return lean_alloc_external(g_bytes_channel_class, ch);
+}
+
+static inline conduit_bytes_channel_t *conduit_bytes_channel_unbox(b_lean_obj_arg obj) {
+    return (conduit_bytes_channel_t *)lean_get_external_data(obj);
+}
+
+/* Copy up to len bytes into the ring (called with mutex held, space > 0
+ * not required). Handles wrap-around with at most two memcpy calls.
+ * Returns the number of bytes actually copied. */
+static size_t bytes_ring_put(conduit_bytes_channel_t *ch, const uint8_t *src, size_t len) {
+    size_t space = ch->capacity - ch->count;
+    size_t n = len < space ? len : space;
+    size_t first = ch->capacity - ch->tail;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(ch->buffer + ch->tail, src, first);
+    memcpy(ch->buffer, src + first, n - first);
+    ch->tail = (ch->tail + n) % ch->capacity;
+    ch->count += n;
+    return n;
+}
+
+/* Copy up to len bytes out of the ring (called with mutex held).
+ * Returns the number of bytes actually copied. */
+static size_t bytes_ring_take(conduit_bytes_channel_t *ch, uint8_t *dst, size_t len) {
+    size_t n = len < ch->count ? len : ch->count;
+    size_t first = ch->capacity - ch->head;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, ch->buffer + ch->head, first);
+    memcpy(dst + first, ch->buffer, n - first);
+    ch->head = (ch->head + n) % ch->capacity;
+    ch->count -= n;
+    return n;
+}
+
+/*
+ * conduit_bytes_channel_new : Nat → IO Channel.Bytes
+ *
+ * Create a byte-stream channel; capacity is in bytes, clamped to ≥ 1.
+ */
+LEAN_EXPORT lean_obj_res conduit_bytes_channel_new(
+    b_lean_obj_arg capacity_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    size_t capacity = lean_usize_of_nat(capacity_obj);
+    if (capacity == 0) {
+        capacity = 1;
+    }
+
+    conduit_bytes_channel_t *ch =
+        (conduit_bytes_channel_t *)malloc(sizeof(conduit_bytes_channel_t));
+    if (!ch) {
+        return mk_io_error("Failed to allocate channel");
+    }
+
+    ch->buffer = (uint8_t *)malloc(capacity);
+    if (!ch->buffer) {
+        free(ch);
+        return mk_io_error("Failed to allocate channel buffer");
+    }
+
+    if (pthread_mutex_init(&ch->mutex, NULL) != 0) {
+        free(ch->buffer);
+        free(ch);
+        return mk_io_error("Failed to initialize mutex");
+    }
+
+    if (cond_init_monotonic(&ch->not_empty) != 0) {
+        pthread_mutex_destroy(&ch->mutex);
+        free(ch->buffer);
+        free(ch);
+        return mk_io_error("Failed to initialize condition variable");
+    }
+
+    if (cond_init_monotonic(&ch->not_full) != 0) {
+        pthread_cond_destroy(&ch->not_empty);
+        pthread_mutex_destroy(&ch->mutex);
+        free(ch->buffer);
+        free(ch);
+        return mk_io_error("Failed to initialize condition variable");
+    }
+
+    ch->capacity = capacity;
+    ch->head = 0;
+    ch->tail = 0;
+    ch->count = 0;
+    ch->closed = false;
+
+    atomic_fetch_add(&g_channel_alloc_count, 1);
+    return lean_io_result_mk_ok(conduit_bytes_channel_box(ch));
+}
+
+/*
+ * conduit_bytes_channel_write : Channel.Bytes → ByteArray → IO Nat
+ *
+ * Block until at least one byte of space is free (or the channel closes),
+ * then copy as much of data as fits under one lock. Returns the number of
+ * bytes written; 0 means the channel is closed (or data was empty).
+ * Callers loop for write-all semantics.
+ */
+LEAN_EXPORT lean_obj_res conduit_bytes_channel_write(
+    b_lean_obj_arg ch_obj,
+    b_lean_obj_arg data_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_bytes_channel_t *ch = conduit_bytes_channel_unbox(ch_obj);
+
+    size_t len = lean_sarray_size(data_obj);
+    if (len == 0) {
+        return lean_io_result_mk_ok(lean_usize_to_nat(0));
+    }
+    const uint8_t *src = lean_sarray_cptr((lean_object *)data_obj);
+
+    pthread_mutex_lock(&ch->mutex);
+
+    while (ch->count >= ch->capacity && !ch->closed) {
+        if (cond_wait_interruptible(&ch->not_full, &ch->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&ch->mutex);
+            return lean_io_result_mk_ok(lean_usize_to_nat(0));
+        }
+    }
+
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        return lean_io_result_mk_ok(lean_usize_to_nat(0));
+    }
+
+    size_t written = bytes_ring_put(ch, src, len);
+
+    pthread_cond_signal(&ch->not_empty);
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(lean_usize_to_nat(written));
+}
+
+/*
+ * conduit_bytes_channel_read : Channel.Bytes → Nat → IO ByteArray
+ *
+ * Block until at least one byte is available (or the channel is closed and
+ * drained), then copy up to max bytes into a single fresh ByteArray.
+ * An empty result means closed-and-drained (or max was 0).
+ */
+LEAN_EXPORT lean_obj_res conduit_bytes_channel_read(
+    b_lean_obj_arg ch_obj,
+    b_lean_obj_arg max_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_bytes_channel_t *ch = conduit_bytes_channel_unbox(ch_obj);
+    size_t max = lean_usize_of_nat(max_obj);
+
+    if (max == 0) {
+        return lean_io_result_mk_ok(lean_alloc_sarray(1, 0, 0));
+    }
+
+    pthread_mutex_lock(&ch->mutex);
+
+    while (ch->count == 0 && !ch->closed) {
+        if (cond_wait_interruptible(&ch->not_empty, &ch->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&ch->mutex);
+            return lean_io_result_mk_ok(lean_alloc_sarray(1, 0, 0));
+        }
+    }
+
+    size_t n = ch->count < max ? ch->count : max;
+    lean_object *out = lean_alloc_sarray(1, n, n);
+    if (n > 0) {
+        bytes_ring_take(ch, lean_sarray_cptr(out), n);
+        pthread_cond_signal(&ch->not_full);
+    }
+
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(out);
+}
+
+LEAN_EXPORT lean_obj_res conduit_bytes_channel_close(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_bytes_channel_t *ch = conduit_bytes_channel_unbox(ch_obj);
+
+    pthread_mutex_lock(&ch->mutex);
+    if (!ch->closed) {
+        ch->closed = true;
+        pthread_cond_broadcast(&ch->not_empty);
+        pthread_cond_broadcast(&ch->not_full);
+    }
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_bytes_channel_is_closed(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_bytes_channel_t *ch = conduit_bytes_channel_unbox(ch_obj);
+
+    pthread_mutex_lock(&ch->mutex);
+    bool closed = ch->closed;
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(lean_box(closed ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_bytes_channel_len(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_bytes_channel_t *ch = conduit_bytes_channel_unbox(ch_obj);
+
+    pthread_mutex_lock(&ch->mutex);
+    size_t count = ch->count;
+    pthread_mutex_unlock(&ch->mutex);
+    return lean_io_result_mk_ok(lean_usize_to_nat(count));
+}
+
+LEAN_EXPORT lean_obj_res conduit_bytes_channel_capacity(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_bytes_channel_t *ch = conduit_bytes_channel_unbox(ch_obj);
+    return lean_io_result_mk_ok(lean_usize_to_nat(ch->capacity));
+}
+
+/* ============================================================================
+ * Shared-Memory Channel (cross-process transport)
+ *
+ * Channel.Shm moves fixed-size byte records between processes through a
+ * ring living in an mmap'ed file, with PTHREAD_PROCESS_SHARED mutex and
+ * condvars beside it in the segment, so an IPC hop becomes a plain
+ * shared-memory enqueue: no syscall, no serialization copy. One process
+ * calls create (which sizes and initializes the segment); peers call
+ * attach on the same path. Records are raw bytes of a fixed size agreed
+ * at create time - the caller owns encoding, and nothing containing
+ * pointers or Lean objects may cross the boundary. The primitives are
+ * not robust: if a peer dies while holding the mutex the segment must be
+ * recreated.
+ * ============================================================================ */
+
+#define CONDUIT_SHM_MAGIC   UINT64_C(0x434f4e4455495453) /* "CONDUITS" */
+#define CONDUIT_SHM_VERSION 1u
+
+/* Lives at the start of the mapped file, followed by
+ * capacity * elem_size record bytes. */
+typedef struct {
+    uint64_t magic;
+    uint32_t version;
+    _Atomic uint32_t ready;       /* Set last by create; checked by attach */
+
+    pthread_mutex_t mutex;        /* All PTHREAD_PROCESS_SHARED */
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+
+    uint64_t capacity;            /* Ring slots (records) */
+    uint64_t elem_size;           /* Bytes per record */
+    uint64_t head;
+    uint64_t tail;
+    uint64_t count;
+    uint32_t closed;
+} conduit_shm_header_t;
+
+/* Process-local handle: just the mapping. The segment itself outlives any
+ * one handle; detaching never tears down the shared primitives. */
+typedef struct {
+    conduit_shm_header_t *hdr;
+    size_t map_len;
+} conduit_shm_channel_t;
+
+static inline uint8_t *shm_slots(conduit_shm_header_t *hdr) {
+    return (uint8_t *)(hdr + 1);
+}
+
+static lean_external_class *g_shm_channel_class = NULL;
 
-        pthread_mutex_unlock(&ch->mutex);
+static void conduit_shm_channel_finalizer(void *ptr) {
+    conduit_shm_channel_t *ch = (conduit_shm_channel_t *)ptr;
+    if (ch) {
+        atomic_fetch_add(&g_channel_free_count, 1);
+        munmap(ch->hdr, ch->map_len);
+        free(ch);
+    }
+}
 
-        if (!success) {
-            /* Channel closed before receiver took value */
-            lean_dec(value);
-            return lean_io_result_mk_ok(lean_box(2)); /* closed */
-        }
+static void conduit_shm_channel_foreach(void *ptr, b_lean_obj_arg f) {
+    /* Raw bytes hold no Lean objects */
+    (void)ptr;
+    (void)f;
+}
 
-        return lean_io_result_mk_ok(lean_box(0)); /* ok */
-    } else {
-        /* Buffered channel: wait for space with timeout */
-        while (ch->count >= ch->capacity && !ch->closed) {
-            int rc = pthread_cond_timedwait(&ch->not_full, &ch->mutex, &deadline);
-            if (rc == ETIMEDOUT) {
-                pthread_mutex_unlock(&ch->mutex);
-                lean_dec(value);
-                return lean_io_result_mk_ok(lean_box(1)); /* timeout */
-            }
-        }
+static inline lean_obj_res conduit_shm_channel_box(conduit_shm_channel_t *ch) {
+    if (g_shm_channel_class == NULL) {
+        g_shm_channel_class = lean_register_external_class(
+            conduit_shm_channel_finalizer,
+            conduit_shm_channel_foreach
+        );
+    }
+    return lean_alloc_external(g_shm_channel_class, ch);
+}
 
-        if (ch->closed) {
-            pthread_mutex_unlock(&ch->mutex);
-            lean_dec(value);
-            return lean_io_result_mk_ok(lean_box(2)); /* closed */
-        }
+static inline conduit_shm_channel_t *conduit_shm_channel_unbox(b_lean_obj_arg obj) {
+    return (conduit_shm_channel_t *)lean_get_external_data(obj);
+}
 
-        /* Add to buffer */
-        ch->buffer[ch->tail] = value;
-        ch->tail = (ch->tail + 1) % ch->capacity;
-        ch->count++;
+/* Initialize the segment's process-shared primitives. Returns 0 on
+ * success, an errno otherwise. */
+static int shm_init_primitives(conduit_shm_header_t *hdr) {
+    pthread_mutexattr_t mattr;
+    pthread_condattr_t cattr;
+    int rc;
+
+    pthread_mutexattr_init(&mattr);
+    rc = pthread_mutexattr_setpshared(&mattr, PTHREAD_PROCESS_SHARED);
+    if (rc == 0) {
+        rc = pthread_mutex_init(&hdr->mutex, &mattr);
+    }
+    pthread_mutexattr_destroy(&mattr);
+    if (rc != 0) {
+        return rc;
+    }
 
-        /* Signal that data is available */
-        pthread_cond_signal(&ch->not_empty);
-        select_notify_waiters(ch);
+    pthread_condattr_init(&cattr);
+    rc = pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED);
+#ifndef __APPLE__
+    if (rc == 0) {
+        rc = pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+    }
+#endif
+    if (rc == 0) {
+        rc = pthread_cond_init(&hdr->not_empty, &cattr);
+    }
+    if (rc == 0) {
+        rc = pthread_cond_init(&hdr->not_full, &cattr);
+    }
+    pthread_condattr_destroy(&cattr);
+    return rc;
+}
 
-        pthread_mutex_unlock(&ch->mutex);
-        return lean_io_result_mk_ok(lean_box(0)); /* ok */
+/* Wrap a mapped segment in a handle. Takes ownership of the mapping. */
+static lean_obj_res shm_wrap(conduit_shm_header_t *hdr, size_t map_len) {
+    conduit_shm_channel_t *ch =
+        (conduit_shm_channel_t *)malloc(sizeof(conduit_shm_channel_t));
+    if (!ch) {
+        munmap(hdr, map_len);
+        return mk_io_error("Failed to allocate channel");
     }
+    ch->hdr = hdr;
+    ch->map_len = map_len;
+    atomic_fetch_add(&g_channel_alloc_count, 1);
+    return lean_io_result_mk_ok(conduit_shm_channel_box(ch));
 }
 
-/* ============================================================================
- * conduit_channel_recv_timeout : Channel α → Nat → IO (Option (Option α))
+/*
+ * conduit_shm_channel_create : String → Nat → Nat → IO Channel.Shm
  *
- * Blocking receive with timeout.
- * Returns: none = timeout, some none = closed, some (some v) = value
- * ============================================================================ */
-
-LEAN_EXPORT lean_obj_res conduit_channel_recv_timeout(
-    b_lean_obj_arg ch_obj,
-    size_t timeout_ms,
+ * Create (or overwrite) the segment file at path and initialize a ring of
+ * capacity records of elemSize bytes each. Both are clamped to ≥ 1.
+ */
+LEAN_EXPORT lean_obj_res conduit_shm_channel_create(
+    b_lean_obj_arg path_obj,
+    b_lean_obj_arg capacity_obj,
+    b_lean_obj_arg elem_size_obj,
     lean_obj_arg world
 ) {
     (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    size_t capacity = lean_usize_of_nat(capacity_obj);
+    size_t elem_size = lean_usize_of_nat(elem_size_obj);
+    if (capacity == 0) {
+        capacity = 1;
+    }
+    if (elem_size == 0) {
+        elem_size = 1;
+    }
+    size_t map_len = sizeof(conduit_shm_header_t) + capacity * elem_size;
 
-    pthread_mutex_lock(&ch->mutex);
+    int fd = open(lean_string_cstr(path_obj), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return mk_io_error("Failed to create shared-memory segment");
+    }
+    if (ftruncate(fd, (off_t)map_len) != 0) {
+        close(fd);
+        return mk_io_error("Failed to size shared-memory segment");
+    }
 
-    /* Calculate deadline */
-    struct timespec deadline;
-    clock_gettime(CLOCK_REALTIME, &deadline);
-    deadline.tv_sec += timeout_ms / 1000;
-    deadline.tv_nsec += (timeout_ms % 1000) * 1000000;
-    if (deadline.tv_nsec >= 1000000000) {
-        deadline.tv_sec++;
-        deadline.tv_nsec -= 1000000000;
+    conduit_shm_header_t *hdr = (conduit_shm_header_t *)mmap(
+        NULL, map_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); /* The mapping keeps the segment alive */
+    if (hdr == MAP_FAILED) {
+        return mk_io_error("Failed to map shared-memory segment");
     }
 
-    if (ch->capacity == 0) {
-        /* Unbuffered channel: wait for sender with timeout */
-        while (!ch->pending_ready && !ch->closed) {
-            ch->waiting_receivers++;
-            int rc = pthread_cond_timedwait(&ch->not_empty, &ch->mutex, &deadline);
-            ch->waiting_receivers--;
-            if (rc == ETIMEDOUT) {
-                pthread_mutex_unlock(&ch->mutex);
-                /* Return none (timeout) */
-                return lean_io_result_mk_ok(lean_box(0));
-            }
-        }
+    if (shm_init_primitives(hdr) != 0) {
+        munmap(hdr, map_len);
+        return mk_io_error("Failed to initialize process-shared primitives");
+    }
 
-        if (ch->pending_ready && !ch->pending_taken) {
-            /* Take the value from sender */
-            lean_object *value = ch->pending_value;
-            ch->pending_taken = true;
-            ch->pending_ready = false;
+    hdr->magic = CONDUIT_SHM_MAGIC;
+    hdr->version = CONDUIT_SHM_VERSION;
+    hdr->capacity = capacity;
+    hdr->elem_size = elem_size;
+    hdr->head = 0;
+    hdr->tail = 0;
+    hdr->count = 0;
+    hdr->closed = 0;
+    /* Published last so a racing attach never sees a half-built segment */
+    atomic_store_explicit(&hdr->ready, 1, memory_order_release);
+
+    return shm_wrap(hdr, map_len);
+}
 
-            /* Signal sender that we took it */
-            pthread_cond_signal(&ch->not_full);
-            select_notify_waiters(ch);
+/*
+ * conduit_shm_channel_attach : String → IO Channel.Shm
+ *
+ * Map an existing segment created by another process (or this one).
+ * Fails if the file is missing, too small, or not a conduit segment.
+ */
+LEAN_EXPORT lean_obj_res conduit_shm_channel_attach(
+    b_lean_obj_arg path_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    int fd = open(lean_string_cstr(path_obj), O_RDWR);
+    if (fd < 0) {
+        return mk_io_error("Failed to open shared-memory segment");
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(conduit_shm_header_t)) {
+        close(fd);
+        return mk_io_error("Not a conduit shared-memory segment");
+    }
+    size_t map_len = (size_t)st.st_size;
 
-            pthread_mutex_unlock(&ch->mutex);
+    conduit_shm_header_t *hdr = (conduit_shm_header_t *)mmap(
+        NULL, map_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (hdr == MAP_FAILED) {
+        return mk_io_error("Failed to map shared-memory segment");
+    }
 
-            /* Return some (some value) */
-            lean_object *inner = lean_alloc_ctor(1, 1, 0);
-            lean_ctor_set(inner, 0, value);
-            lean_object *outer = lean_alloc_ctor(1, 1, 0);
-            lean_ctor_set(outer, 0, inner);
-            return lean_io_result_mk_ok(outer);
-        }
+    /* The ring-size check divides instead of multiplying: capacity *
+     * elem_size can wrap in a corrupt or crafted file, passing a check
+     * whose ring extends past the mapping and turning the first send
+     * into a SIGBUS. create clamps both to >= 1, so zero means corrupt. */
+    if (hdr->magic != CONDUIT_SHM_MAGIC ||
+        hdr->version != CONDUIT_SHM_VERSION ||
+        atomic_load_explicit(&hdr->ready, memory_order_acquire) != 1 ||
+        hdr->capacity == 0 || hdr->elem_size == 0 ||
+        hdr->capacity >
+            (map_len - sizeof(conduit_shm_header_t)) / hdr->elem_size) {
+        munmap(hdr, map_len);
+        return mk_io_error("Not a conduit shared-memory segment");
+    }
 
-        /* Channel closed, no pending value */
-        pthread_mutex_unlock(&ch->mutex);
-        /* Return some none (closed) */
-        lean_object *outer = lean_alloc_ctor(1, 1, 0);
-        lean_ctor_set(outer, 0, lean_box(0));
-        return lean_io_result_mk_ok(outer);
-    } else {
-        /* Buffered channel: wait for data with timeout */
-        while (ch->count == 0 && !ch->closed) {
-            int rc = pthread_cond_timedwait(&ch->not_empty, &ch->mutex, &deadline);
-            if (rc == ETIMEDOUT) {
-                pthread_mutex_unlock(&ch->mutex);
-                /* Return none (timeout) */
-                return lean_io_result_mk_ok(lean_box(0));
-            }
-        }
+    return shm_wrap(hdr, map_len);
+}
 
-        if (ch->count == 0) {
-            /* Channel closed and empty */
-            pthread_mutex_unlock(&ch->mutex);
-            /* Return some none (closed) */
-            lean_object *outer = lean_alloc_ctor(1, 1, 0);
-            lean_ctor_set(outer, 0, lean_box(0));
-            return lean_io_result_mk_ok(outer);
-        }
+/*
+ * conduit_shm_channel_send : Channel.Shm → ByteArray → IO Bool
+ *
+ * Copy one record into the ring, blocking while it is full. The record
+ * must be exactly elemSize bytes. Returns false if the segment is closed.
+ */
+LEAN_EXPORT lean_obj_res conduit_shm_channel_send(
+    b_lean_obj_arg ch_obj,
+    b_lean_obj_arg data_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_shm_header_t *hdr = conduit_shm_channel_unbox(ch_obj)->hdr;
 
-        /* Take from buffer */
-        lean_object *value = ch->buffer[ch->head];
-        ch->buffer[ch->head] = NULL;
-        ch->head = (ch->head + 1) % ch->capacity;
-        ch->count--;
+    if (lean_sarray_size(data_obj) != hdr->elem_size) {
+        return mk_io_error("Record size does not match segment elemSize");
+    }
 
-        /* Signal that space is available */
-        pthread_cond_signal(&ch->not_full);
-        select_notify_waiters(ch);
+    pthread_mutex_lock(&hdr->mutex);
 
-        pthread_mutex_unlock(&ch->mutex);
+    while (hdr->count >= hdr->capacity && !hdr->closed) {
+        if (cond_wait_interruptible(&hdr->not_full, &hdr->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&hdr->mutex);
+            return lean_io_result_mk_ok(lean_box(0)); /* false */
+        }
+    }
 
-        /* Return some (some value) */
-        lean_object *inner = lean_alloc_ctor(1, 1, 0);
-        lean_ctor_set(inner, 0, value);
-        lean_object *outer = lean_alloc_ctor(1, 1, 0);
-        lean_ctor_set(outer, 0, inner);
-        return lean_io_result_mk_ok(outer);
+    if (hdr->closed) {
+        pthread_mutex_unlock(&hdr->mutex);
+        return lean_io_result_mk_ok(lean_box(0)); /* false */
     }
+
+    memcpy(shm_slots(hdr) + hdr->tail * hdr->elem_size,
+           lean_sarray_cptr((lean_object *)data_obj), hdr->elem_size);
+    hdr->tail = (hdr->tail + 1) % hdr->capacity;
+    hdr->count++;
+
+    pthread_cond_signal(&hdr->not_empty);
+    pthread_mutex_unlock(&hdr->mutex);
+    return lean_io_result_mk_ok(lean_box(1)); /* true */
 }
 
-/* ============================================================================
- * conduit_channel_close : Channel α → IO Unit
+/*
+ * conduit_shm_channel_recv : Channel.Shm → IO (Option ByteArray)
  *
- * Close the channel. Wakes all waiting senders/receivers.
- * ============================================================================ */
-
-LEAN_EXPORT lean_obj_res conduit_channel_close(
+ * Copy one record out of the ring, blocking while it is empty. Returns
+ * none once the segment is closed and drained.
+ */
+LEAN_EXPORT lean_obj_res conduit_shm_channel_recv(
     b_lean_obj_arg ch_obj,
     lean_obj_arg world
 ) {
     (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    conduit_shm_header_t *hdr = conduit_shm_channel_unbox(ch_obj)->hdr;
 
-    pthread_mutex_lock(&ch->mutex);
+    pthread_mutex_lock(&hdr->mutex);
 
-    if (!ch->closed) {
-        ch->closed = true;
+    while (hdr->count == 0 && !hdr->closed) {
+        if (cond_wait_interruptible(&hdr->not_empty, &hdr->mutex) == ECANCELED) {
+            pthread_mutex_unlock(&hdr->mutex);
+            return lean_io_result_mk_ok(lean_box(0)); /* none */
+        }
+    }
 
-        /* Wake all waiting threads */
-        pthread_cond_broadcast(&ch->not_empty);
-        pthread_cond_broadcast(&ch->not_full);
-        select_notify_waiters(ch);
+    if (hdr->count == 0) {
+        /* Closed and drained */
+        pthread_mutex_unlock(&hdr->mutex);
+        return lean_io_result_mk_ok(lean_box(0)); /* none */
     }
 
-    pthread_mutex_unlock(&ch->mutex);
+    lean_object *out = lean_alloc_sarray(1, hdr->elem_size, hdr->elem_size);
+    memcpy(lean_sarray_cptr(out),
+           shm_slots(hdr) + hdr->head * hdr->elem_size, hdr->elem_size);
+    hdr->head = (hdr->head + 1) % hdr->capacity;
+    hdr->count--;
 
-    return lean_io_result_mk_ok(lean_box(0));
-}
+    pthread_cond_signal(&hdr->not_full);
+    pthread_mutex_unlock(&hdr->mutex);
 
-/* ============================================================================
- * conduit_channel_is_closed : Channel α → IO Bool
- * ============================================================================ */
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, out);
+    return lean_io_result_mk_ok(some);
+}
 
-LEAN_EXPORT lean_obj_res conduit_channel_is_closed(
+LEAN_EXPORT lean_obj_res conduit_shm_channel_close(
     b_lean_obj_arg ch_obj,
     lean_obj_arg world
 ) {
     (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    conduit_shm_header_t *hdr = conduit_shm_channel_unbox(ch_obj)->hdr;
 
-    pthread_mutex_lock(&ch->mutex);
-    bool closed = ch->closed;
-    pthread_mutex_unlock(&ch->mutex);
+    pthread_mutex_lock(&hdr->mutex);
+    if (!hdr->closed) {
+        hdr->closed = 1;
+        pthread_cond_broadcast(&hdr->not_empty);
+        pthread_cond_broadcast(&hdr->not_full);
+    }
+    pthread_mutex_unlock(&hdr->mutex);
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+LEAN_EXPORT lean_obj_res conduit_shm_channel_is_closed(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_shm_header_t *hdr = conduit_shm_channel_unbox(ch_obj)->hdr;
 
+    pthread_mutex_lock(&hdr->mutex);
+    bool closed = hdr->closed != 0;
+    pthread_mutex_unlock(&hdr->mutex);
     return lean_io_result_mk_ok(lean_box(closed ? 1 : 0));
 }
 
-/* ============================================================================
- * conduit_channel_len : Channel α → IO Nat
- *
- * Get current number of items in buffer (0 for unbuffered).
- * ============================================================================ */
-
-LEAN_EXPORT lean_obj_res conduit_channel_len(
+LEAN_EXPORT lean_obj_res conduit_shm_channel_len(
     b_lean_obj_arg ch_obj,
     lean_obj_arg world
 ) {
     (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
-
-    pthread_mutex_lock(&ch->mutex);
-    size_t len = ch->count;
-    pthread_mutex_unlock(&ch->mutex);
+    conduit_shm_header_t *hdr = conduit_shm_channel_unbox(ch_obj)->hdr;
 
-    return lean_io_result_mk_ok(lean_usize_to_nat(len));
+    pthread_mutex_lock(&hdr->mutex);
+    size_t count = (size_t)hdr->count;
+    pthread_mutex_unlock(&hdr->mutex);
+    return lean_io_result_mk_ok(lean_usize_to_nat(count));
 }
 
-/* ============================================================================
- * conduit_channel_capacity : Channel α → IO Nat
- *
- * Get buffer capacity (0 for unbuffered).
- * ============================================================================ */
-
-LEAN_EXPORT lean_obj_res conduit_channel_capacity(
+LEAN_EXPORT lean_obj_res conduit_shm_channel_capacity(
     b_lean_obj_arg ch_obj,
     lean_obj_arg world
 ) {
     (void)world;
-    conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+    conduit_shm_header_t *hdr = conduit_shm_channel_unbox(ch_obj)->hdr;
+    /* Immutable after create, no lock needed */
+    return lean_io_result_mk_ok(lean_usize_to_nat((size_t)hdr->capacity));
+}
 
-    /* Capacity is immutable, no lock needed */
-    return lean_io_result_mk_ok(lean_usize_to_nat(ch->capacity));
+LEAN_EXPORT lean_obj_res conduit_shm_channel_elem_size(
+    b_lean_obj_arg ch_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_shm_header_t *hdr = conduit_shm_channel_unbox(ch_obj)->hdr;
+    return lean_io_result_mk_ok(lean_usize_to_nat((size_t)hdr->elem_size));
 }
 
 /* ============================================================================
- * Select Waiter Helpers
+ * Rendezvous (request/reply round-trips)
+ *
+ * Request/reply over channels needs a fresh reply channel per request -
+ * a malloc, a mutex init, and two condvar inits for exactly one handoff.
+ * A rendezvous instead parks each caller on a one-shot slot that lives
+ * on the caller's own stack: the slot holds the request, a condvar, and
+ * room for the reply. Callers queue their slots FIFO under the
+ * rendezvous mutex; a server dequeues a slot, runs the Lean handler with
+ * no locks held, writes the reply straight into the slot, and signals
+ * its condvar - one wake, zero heap allocation per round-trip.
  * ============================================================================ */
 
-/* Register a select waiter on a channel (called with channel mutex held) */
-static void select_register_waiter(conduit_channel_t *ch, conduit_select_waiter_t *w) {
-    w->next = ch->select_waiters;
-    ch->select_waiters = w;
+typedef struct conduit_rdv_slot {
+    lean_object *request;         /* Owned by the slot until a server takes it */
+    lean_object *reply;           /* Set by the server; NULL means no reply */
+    bool taken;                   /* A server dequeued this slot */
+    bool done;                    /* Reply written (or rendezvous closed) */
+    pthread_cond_t cond;          /* The caller sleeps here */
+    struct conduit_rdv_slot *next;
+} conduit_rdv_slot_t;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;     /* Signals servers when a caller queues */
+    conduit_rdv_slot_t *head;     /* FIFO queue of parked callers */
+    conduit_rdv_slot_t *tail;
+    bool closed;
+} conduit_rendezvous_t;
+
+static lean_external_class *g_rendezvous_class = NULL;
+
+static void conduit_rendezvous_finalizer(void *ptr) {
+    conduit_rendezvous_t *r = (conduit_rendezvous_t *)ptr;
+    if (r) {
+        /* Callers hold a reference while parked, so the queue is empty
+         * by the time the last reference drops. */
+        atomic_fetch_add(&g_channel_free_count, 1);
+        pthread_mutex_destroy(&r->mutex);
+        pthread_cond_destroy(&r->not_empty);
+        free(r);
+    }
 }
 
-/* Unregister a select waiter from a channel (called with channel mutex held) */
-static void select_unregister_waiter(conduit_channel_t *ch, conduit_select_waiter_t *w) {
-    conduit_select_waiter_t **pp = &ch->select_waiters;
+static void conduit_rendezvous_foreach(void *ptr, b_lean_obj_arg f) {
+    /* Queued requests are owned by caller stack slots, not the handle */
+    (void)ptr;
+    (void)f;
+}
+
+static inline lean_obj_res conduit_rendezvous_box(conduit_rendezvous_t *r) {
+    if (g_rendezvous_class == NULL) {
+        g_rendezvous_class = lean_register_external_class(
+            conduit_rendezvous_finalizer,
+            conduit_rendezvous_foreach
+        );
+    }
+    return lean_alloc_external(g_rendezvous_class, r);
+}
+
+static inline conduit_rendezvous_t *conduit_rendezvous_unbox(b_lean_obj_arg obj) {
+    return (conduit_rendezvous_t *)lean_get_external_data(obj);
+}
+
+/* Remove a slot from the queue (called with the mutex held). Used when a
+ * parked caller is canceled or the rendezvous closes under it. */
+static void rdv_remove_slot(conduit_rendezvous_t *r, conduit_rdv_slot_t *slot) {
+    conduit_rdv_slot_t **pp = &r->head;
+    conduit_rdv_slot_t *prev = NULL;
     while (*pp != NULL) {
-        if (*pp == w) {
-            *pp = w->next;
+        if (*pp == slot) {
+            *pp = slot->next;
+            if (r->tail == slot) {
+                r->tail = prev;
+            }
             return;
         }
+        prev = *pp;
         pp = &(*pp)->next;
     }
-}
-
-/* Notify all select waiters on a channel (called with channel mutex held) */
-static void select_notify_waiters(conduit_channel_t *ch) {
-    conduit_select_waiter_t *w = ch->select_waiters;
-    while (w != NULL) {
-        pthread_mutex_lock(w->mutex);
-        w->notified = true;
-        pthread_cond_signal(w->cond);
-        pthread_mutex_unlock(w->mutex);
-        w = w->next;
+}
+
+/*
+ * conduit_rendezvous_new : Type → Type → IO (Rendezvous α β)
+ *
+ * Create a rendezvous. Type parameters are erased at runtime.
+ */
+LEAN_EXPORT lean_obj_res conduit_rendezvous_new(lean_obj_arg world) {
+    (void)world;
+    conduit_rendezvous_t *r =
+        (conduit_rendezvous_t *)malloc(sizeof(conduit_rendezvous_t));
+    if (!r) {
+        return mk_io_error("Failed to allocate channel");
+    }
+    if (pthread_mutex_init(&r->mutex, NULL) != 0) {
+        free(r);
+        return mk_io_error("Failed to initialize mutex");
+    }
+    if (cond_init_monotonic(&r->not_empty) != 0) {
+        pthread_mutex_destroy(&r->mutex);
+        free(r);
+        return mk_io_error("Failed to initialize condition variable");
     }
-}
+    r->head = NULL;
+    r->tail = NULL;
+    r->closed = false;
 
-/* ============================================================================
- * Select Implementation
- * ============================================================================ */
+    atomic_fetch_add(&g_channel_alloc_count, 1);
+    return lean_io_result_mk_ok(conduit_rendezvous_box(r));
+}
 
 /*
- * conduit_select_poll : Array (Channel × Bool) → IO (Option Nat)
+ * conduit_rendezvous_call : Rendezvous α β → α → IO (Option β)
  *
- * Poll an array of (channel, is_send) pairs. Returns index of first ready
- * channel, or none if none are ready.
- *
- * is_send: true = check if can send, false = check if can recv
+ * Park on a stack slot until a server replies. Returns none if the
+ * rendezvous is closed or the calling task is canceled first.
  */
-LEAN_EXPORT lean_obj_res conduit_select_poll(
-    b_lean_obj_arg cases_obj,
+LEAN_EXPORT lean_obj_res conduit_rendezvous_call(
+    b_lean_obj_arg rdv_obj,
+    lean_obj_arg request,
     lean_obj_arg world
 ) {
     (void)world;
+    conduit_rendezvous_t *r = conduit_rendezvous_unbox(rdv_obj);
+
+    conduit_rdv_slot_t slot;
+    slot.request = request;
+    slot.reply = NULL;
+    slot.taken = false;
+    slot.done = false;
+    slot.next = NULL;
+    if (cond_init_monotonic(&slot.cond) != 0) {
+        lean_dec(request);
+        return mk_io_error("Failed to initialize condition variable");
+    }
 
-    size_t n = lean_array_size(cases_obj);
-
-    for (size_t i = 0; i < n; i++) {
-        lean_object *pair = lean_array_get_core(cases_obj, i);
-        lean_object *ch_obj = lean_ctor_get(pair, 0);
-        bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
-
-        conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
-
-        pthread_mutex_lock(&ch->mutex);
+    pthread_mutex_lock(&r->mutex);
 
-        bool ready = false;
+    if (r->closed) {
+        pthread_mutex_unlock(&r->mutex);
+        pthread_cond_destroy(&slot.cond);
+        lean_dec(request);
+        return lean_io_result_mk_ok(lean_box(0)); /* none */
+    }
 
-        if (is_send) {
-            /* Can send if: not closed AND (buffered with space OR unbuffered with waiting receiver) */
-            if (!ch->closed) {
-                if (ch->capacity > 0 && ch->count < ch->capacity) {
-                    ready = true;
-                } else if (ch->capacity == 0 && ch->waiting_receivers > 0 && !ch->pending_ready) {
-                    /* Unbuffered with waiting receiver and no send in progress */
-                    ready = true;
+    /* Enqueue FIFO and wake one server */
+    if (r->tail) {
+        r->tail->next = &slot;
+    } else {
+        r->head = &slot;
+    }
+    r->tail = &slot;
+    pthread_cond_signal(&r->not_empty);
+
+    while (!slot.done) {
+        if (!slot.taken) {
+            if (r->closed ||
+                cond_wait_interruptible(&slot.cond, &r->mutex) == ECANCELED) {
+                if (slot.taken) {
+                    /* A server grabbed the slot while we were waking:
+                     * it will reply, so fall through and wait for it. */
+                    continue;
                 }
+                rdv_remove_slot(r, &slot);
+                pthread_mutex_unlock(&r->mutex);
+                pthread_cond_destroy(&slot.cond);
+                lean_dec(slot.request);
+                return lean_io_result_mk_ok(lean_box(0)); /* none */
             }
         } else {
-            /* Can recv if: has data OR (unbuffered with pending and not yet taken) OR closed */
-            if (ch->count > 0 || (ch->pending_ready && !ch->pending_taken) || ch->closed) {
-                ready = true;
-            }
-        }
-
-        pthread_mutex_unlock(&ch->mutex);
-
-        if (ready) {
-            /* Return Some i */
-            lean_object *some = lean_alloc_ctor(1, 1, 0);
-            lean_ctor_set(some, 0, lean_usize_to_nat(i));
-            return lean_io_result_mk_ok(some);
+            /* The server owns our slot now; it signals when the reply
+             * lands, so this wait is bounded by the handler's runtime
+             * and must not be abandoned (the slot is stack memory). */
+            pthread_cond_wait(&slot.cond, &r->mutex);
         }
     }
 
-    /* None ready */
-    return lean_io_result_mk_ok(lean_box(0)); /* none */
-}
+    pthread_mutex_unlock(&r->mutex);
+    pthread_cond_destroy(&slot.cond);
 
-/* Comparison function for sorting channels by address */
-static int compare_channels(const void *a, const void *b) {
-    conduit_channel_t *ca = *(conduit_channel_t **)a;
-    conduit_channel_t *cb = *(conduit_channel_t **)b;
-    if (ca < cb) return -1;
-    if (ca > cb) return 1;
-    return 0;
+    if (slot.reply == NULL) {
+        return lean_io_result_mk_ok(lean_box(0)); /* none (handler failed) */
+    }
+    lean_object *some = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(some, 0, slot.reply);
+    return lean_io_result_mk_ok(some);
 }
 
 /*
- * conduit_select_wait : Array (Channel × Bool) → Nat → IO (Option Nat)
+ * conduit_rendezvous_serve : Rendezvous α β → (α → IO β) → IO Unit
  *
- * Wait for any channel to become ready, with timeout in milliseconds.
- * timeout = 0 means wait forever.
- * Returns index of ready channel, or none on timeout.
- *
- * Uses proper condition variable signaling for immediate wake-up.
+ * Serve calls until the rendezvous closes or the serving task is
+ * canceled. The handler runs with no locks held; if it throws, the
+ * waiting caller sees none and the error propagates out of serve.
  */
-LEAN_EXPORT lean_obj_res conduit_select_wait(
-    b_lean_obj_arg cases_obj,
-    b_lean_obj_arg timeout_obj,
+LEAN_EXPORT lean_obj_res conduit_rendezvous_serve(
+    b_lean_obj_arg rdv_obj,
+    lean_obj_arg handler,
     lean_obj_arg world
 ) {
-    size_t n = lean_array_size(cases_obj);
-    if (n == 0) {
-        return lean_io_result_mk_ok(lean_box(0)); /* none */
-    }
-
-    size_t timeout_ms = lean_usize_of_nat(timeout_obj);
-    lean_object *result;
-    lean_object *inner;
+    (void)world;
+    conduit_rendezvous_t *r = conduit_rendezvous_unbox(rdv_obj);
+
+    for (;;) {
+        pthread_mutex_lock(&r->mutex);
+        while (r->head == NULL && !r->closed) {
+            if (cond_wait_interruptible(&r->not_empty, &r->mutex) == ECANCELED) {
+                pthread_mutex_unlock(&r->mutex);
+                lean_dec(handler);
+                return lean_io_result_mk_ok(lean_box(0));
+            }
+        }
+        if (r->head == NULL) {
+            /* Closed and no parked callers remain */
+            pthread_mutex_unlock(&r->mutex);
+            lean_dec(handler);
+            return lean_io_result_mk_ok(lean_box(0));
+        }
 
-retry:
-    /* 1. First poll without waiting (fast path) */
-    result = conduit_select_poll(cases_obj, world);
-    inner = lean_ctor_get(result, 0);
-    if (!lean_is_scalar(inner)) {
-        return result; /* Already ready */
-    }
-    lean_dec(result);
+        conduit_rdv_slot_t *slot = r->head;
+        r->head = slot->next;
+        if (r->head == NULL) {
+            r->tail = NULL;
+        }
+        slot->next = NULL;
+        slot->taken = true;
+        lean_object *request = slot->request;
+        slot->request = NULL;
+        pthread_mutex_unlock(&r->mutex);
+
+        lean_inc(handler);
+        lean_object *res = lean_apply_2(handler, request, lean_io_mk_world());
+
+        lean_object *reply = NULL;
+        bool ok = lean_io_result_is_ok(res);
+        if (ok) {
+            reply = lean_io_result_get_value(res);
+            lean_inc(reply);
+            lean_dec(res);
+        }
 
-    /* 2. Collect unique channels and sort by address (for deadlock prevention) */
-    conduit_channel_t **channels = (conduit_channel_t **)malloc(n * sizeof(conduit_channel_t *));
-    if (!channels) {
-        return lean_io_result_mk_ok(lean_box(0)); /* none on alloc failure */
-    }
+        pthread_mutex_lock(&r->mutex);
+        slot->reply = reply;
+        slot->done = true;
+        pthread_cond_signal(&slot->cond);
+        pthread_mutex_unlock(&r->mutex);
 
-    for (size_t i = 0; i < n; i++) {
-        lean_object *pair = lean_array_get_core(cases_obj, i);
-        lean_object *ch_obj = lean_ctor_get(pair, 0);
-        channels[i] = conduit_channel_unbox(ch_obj);
+        if (!ok) {
+            /* Caller was woken with none; surface the handler's error */
+            lean_dec(handler);
+            return res;
+        }
     }
+}
 
-    /* Sort by address to prevent deadlock when locking multiple channels */
-    qsort(channels, n, sizeof(conduit_channel_t *), compare_channels);
-
-    /* Remove duplicates (keep unique channels only) */
-    size_t unique_count = 0;
-    for (size_t i = 0; i < n; i++) {
-        if (unique_count == 0 || channels[i] != channels[unique_count - 1]) {
-            channels[unique_count++] = channels[i];
+/*
+ * conduit_rendezvous_close : Rendezvous α β → IO Unit
+ *
+ * Close the rendezvous: parked callers wake with none, future calls
+ * return none immediately, servers drain and return. Idempotent.
+ */
+LEAN_EXPORT lean_obj_res conduit_rendezvous_close(
+    b_lean_obj_arg rdv_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_rendezvous_t *r = conduit_rendezvous_unbox(rdv_obj);
+
+    pthread_mutex_lock(&r->mutex);
+    if (!r->closed) {
+        r->closed = true;
+        pthread_cond_broadcast(&r->not_empty);
+        for (conduit_rdv_slot_t *s = r->head; s != NULL; s = s->next) {
+            pthread_cond_broadcast(&s->cond);
         }
     }
+    pthread_mutex_unlock(&r->mutex);
+    return lean_io_result_mk_ok(lean_box(0));
+}
 
-    /* 3. Create waiter structure */
-    pthread_mutex_t wait_mutex;
-    pthread_cond_t wait_cond;
-    pthread_mutex_init(&wait_mutex, NULL);
-    pthread_cond_init(&wait_cond, NULL);
+LEAN_EXPORT lean_obj_res conduit_rendezvous_is_closed(
+    b_lean_obj_arg rdv_obj,
+    lean_obj_arg world
+) {
+    (void)world;
+    conduit_rendezvous_t *r = conduit_rendezvous_unbox(rdv_obj);
 
-    conduit_select_waiter_t waiter = {
-        .cond = &wait_cond,
-        .mutex = &wait_mutex,
-        .notified = false,
-        .next = NULL
-    };
+    pthread_mutex_lock(&r->mutex);
+    bool closed = r->closed;
+    pthread_mutex_unlock(&r->mutex);
+    return lean_io_result_mk_ok(lean_box(closed ? 1 : 0));
+}
 
-    /* 4. Lock all channels (in sorted order) and register waiter */
-    for (size_t i = 0; i < unique_count; i++) {
-        pthread_mutex_lock(&channels[i]->mutex);
-        select_register_waiter(channels[i], &waiter);
-    }
+/* ============================================================================
+ * Timer Channels
+ *
+ * Channel.after and Channel.ticker are serviced by one shared timer thread
+ * holding a binary min-heap of monotonic deadlines, so thousands of
+ * concurrent timeouts cost one sleeping thread instead of a dedicated Lean
+ * task each. Timer channels are ordinary capacity-1 buffered channels, so
+ * they compose with select. Ticks that find the slot still occupied are
+ * dropped (and counted): a slow receiver sees the latest tick, not a
+ * growing backlog. Closing a ticker channel retires its timer on the next
+ * fire.
+ * ============================================================================ */
 
-    /* 5. Check if any ready now (may have become ready while registering) */
-    bool found_ready = false;
-    for (size_t i = 0; i < n && !found_ready; i++) {
-        lean_object *pair = lean_array_get_core(cases_obj, i);
-        lean_object *ch_obj = lean_ctor_get(pair, 0);
-        bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
-        conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
+/* From the Lean runtime: threads that may run finalizers / release objects
+ * must be registered with the runtime. */
+extern void lean_initialize_thread(void);
 
-        /* Note: we already hold the lock on this channel */
-        if (is_send) {
-            if (!ch->closed) {
-                if (ch->capacity > 0 && ch->count < ch->capacity) {
-                    found_ready = true;
-                } else if (ch->capacity == 0 && ch->waiting_receivers > 0 && !ch->pending_ready) {
-                    found_ready = true;
-                }
-            }
-        } else {
-            if (ch->count > 0 || (ch->pending_ready && !ch->pending_taken) || ch->closed) {
-                found_ready = true;
-            }
+typedef struct {
+    uint64_t deadline_ns;     /* Monotonic fire time */
+    uint64_t period_ns;       /* 0 = one-shot */
+    conduit_channel_t *ch;
+    lean_object *ch_obj;      /* Owned reference; released when the timer dies */
+} conduit_timer_t;
+
+static pthread_mutex_t g_timer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_timer_cond;
+static conduit_timer_t *g_timer_heap = NULL;
+static size_t g_timer_count = 0;
+static size_t g_timer_cap = 0;
+static pthread_once_t g_timer_once = PTHREAD_ONCE_INIT;
+
+/* Push onto the min-heap (ordered by deadline). Called with g_timer_mutex
+ * held. Returns false on allocation failure. */
+static bool timer_heap_push(const conduit_timer_t *t) {
+    if (g_timer_count == g_timer_cap) {
+        size_t cap = g_timer_cap == 0 ? 16 : g_timer_cap * 2;
+        conduit_timer_t *heap =
+            (conduit_timer_t *)realloc(g_timer_heap, cap * sizeof(conduit_timer_t));
+        if (!heap) {
+            return false;
+        }
+        g_timer_heap = heap;
+        g_timer_cap = cap;
+    }
+    size_t i = g_timer_count++;
+    g_timer_heap[i] = *t;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (g_timer_heap[parent].deadline_ns <= g_timer_heap[i].deadline_ns) {
+            break;
         }
+        conduit_timer_t tmp = g_timer_heap[parent];
+        g_timer_heap[parent] = g_timer_heap[i];
+        g_timer_heap[i] = tmp;
+        i = parent;
     }
+    return true;
+}
 
-    if (found_ready) {
-        /* Unregister and unlock immediately */
-        for (size_t i = unique_count; i > 0; i--) {
-            select_unregister_waiter(channels[i-1], &waiter);
-            pthread_mutex_unlock(&channels[i-1]->mutex);
+/* Remove the earliest timer. Called with g_timer_mutex held. */
+static void timer_heap_pop(void) {
+    g_timer_heap[0] = g_timer_heap[--g_timer_count];
+    size_t i = 0;
+    for (;;) {
+        size_t left = 2 * i + 1;
+        size_t right = left + 1;
+        size_t min = i;
+        if (left < g_timer_count &&
+            g_timer_heap[left].deadline_ns < g_timer_heap[min].deadline_ns) {
+            min = left;
         }
-        pthread_cond_destroy(&wait_cond);
-        pthread_mutex_destroy(&wait_mutex);
-        free(channels);
-        return conduit_select_poll(cases_obj, world);
+        if (right < g_timer_count &&
+            g_timer_heap[right].deadline_ns < g_timer_heap[min].deadline_ns) {
+            min = right;
+        }
+        if (min == i) {
+            break;
+        }
+        conduit_timer_t tmp = g_timer_heap[min];
+        g_timer_heap[min] = g_timer_heap[i];
+        g_timer_heap[i] = tmp;
+        i = min;
     }
+}
 
-    /* 6. Not ready - unlock channels and wait on condition */
-    pthread_mutex_lock(&wait_mutex);
-    for (size_t i = unique_count; i > 0; i--) {
-        pthread_mutex_unlock(&channels[i-1]->mutex);
+/* Deliver a tick into a timer channel. One-shot timers close the channel
+ * after the tick. Returns true if the channel was already closed, telling
+ * the caller to retire the timer. */
+static bool timer_deliver(conduit_channel_t *ch, bool close_after) {
+    pthread_mutex_lock(&ch->mutex);
+    if (ch->closed) {
+        pthread_mutex_unlock(&ch->mutex);
+        return true;
+    }
+    if (ch->count < ch->capacity && buffer_reserve(ch, ch->count + 1)) {
+        ch->buffer[ch->tail] = lean_box(0);
+        ch->tail = (ch->tail + 1) % ch->buf_cap;
+        ch->count++;
+        depth_publish(ch);
+    } else {
+        /* Receiver is behind (or the ring could not grow): drop the tick
+         * rather than queue a backlog */
+        atomic_fetch_add_explicit(&ch->dropped, 1, memory_order_relaxed);
+    }
+    if (close_after) {
+        ch->closed = true;
+        pthread_cond_broadcast(&ch->not_empty);
+        pthread_cond_broadcast(&ch->not_full);
+        select_notify_waiters(ch, SELECT_EVENT_ANY);
+    } else {
+        pthread_cond_signal(&ch->not_empty);
+        select_notify_waiters(ch, SELECT_EVENT_RECV_READY);
     }
+    pthread_mutex_unlock(&ch->mutex);
+    return false;
+}
 
-    /* 7. Wait loop with timeout */
-    struct timespec deadline;
-    if (timeout_ms > 0) {
-        clock_gettime(CLOCK_REALTIME, &deadline);
-        deadline.tv_sec += timeout_ms / 1000;
-        deadline.tv_nsec += (timeout_ms % 1000) * 1000000;
-        if (deadline.tv_nsec >= 1000000000) {
-            deadline.tv_sec++;
-            deadline.tv_nsec -= 1000000000;
+static void *timer_thread_main(void *arg) {
+    (void)arg;
+    lean_initialize_thread();
+
+    pthread_mutex_lock(&g_timer_mutex);
+    for (;;) {
+        if (g_timer_count == 0) {
+            pthread_cond_wait(&g_timer_cond, &g_timer_mutex);
+            continue;
         }
-    }
 
-    while (!waiter.notified) {
-        if (timeout_ms == 0) {
-            cond_wait_interruptible(&wait_cond, &wait_mutex);
+        uint64_t now = stats_now_ns();
+        uint64_t next = g_timer_heap[0].deadline_ns;
+        if (next > now) {
+            struct timespec deadline;
+            deadline.tv_sec = (time_t)(next / 1000000000ull);
+            deadline.tv_nsec = (long)(next % 1000000000ull);
+            cond_timedwait_deadline(&g_timer_cond, &g_timer_mutex, &deadline);
+            continue;
+        }
+
+        conduit_timer_t t = g_timer_heap[0];
+        timer_heap_pop();
+        pthread_mutex_unlock(&g_timer_mutex);
+
+        bool retired = timer_deliver(t.ch, t.period_ns == 0);
+
+        if (t.period_ns == 0 || retired) {
+            lean_dec(t.ch_obj);
+            pthread_mutex_lock(&g_timer_mutex);
         } else {
-            int rc = pthread_cond_timedwait(&wait_cond, &wait_mutex, &deadline);
-            if (rc == ETIMEDOUT) {
-                break;
+            /* Re-arm; skip missed ticks instead of bursting to catch up */
+            t.deadline_ns += t.period_ns;
+            uint64_t after_fire = stats_now_ns();
+            if (t.deadline_ns <= after_fire) {
+                t.deadline_ns = after_fire + t.period_ns;
+            }
+            pthread_mutex_lock(&g_timer_mutex);
+            if (!timer_heap_push(&t)) {
+                pthread_mutex_unlock(&g_timer_mutex);
+                lean_dec(t.ch_obj);
+                pthread_mutex_lock(&g_timer_mutex);
             }
         }
     }
-    pthread_mutex_unlock(&wait_mutex);
+    return NULL;
+}
 
-    /* 8. Unregister from all channels */
-    for (size_t i = 0; i < unique_count; i++) {
-        pthread_mutex_lock(&channels[i]->mutex);
-        select_unregister_waiter(channels[i], &waiter);
-        pthread_mutex_unlock(&channels[i]->mutex);
-    }
+static void timer_thread_start(void) {
+    cond_init_monotonic(&g_timer_cond);
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_create(&thread, &attr, timer_thread_main, NULL);
+    pthread_attr_destroy(&attr);
+}
 
-    /* 9. Final poll to get ready index */
-    result = conduit_select_poll(cases_obj, world);
+/* Register a timer holding its own reference to the channel object. */
+static bool timer_add(lean_object *ch_obj, uint64_t delay_ms, uint64_t period_ms) {
+    conduit_timer_t t;
+    t.deadline_ns = stats_now_ns() + delay_ms * 1000000ull;
+    t.period_ns = period_ms * 1000000ull;
+    t.ch = conduit_channel_unbox(ch_obj);
+    t.ch_obj = ch_obj;
+
+    pthread_mutex_lock(&g_timer_mutex);
+    bool ok = timer_heap_push(&t);
+    if (ok) {
+        pthread_cond_signal(&g_timer_cond);
+    }
+    pthread_mutex_unlock(&g_timer_mutex);
+    return ok;
+}
 
-    /* 10. Cleanup */
-    pthread_cond_destroy(&wait_cond);
-    pthread_mutex_destroy(&wait_mutex);
-    free(channels);
+/*
+ * conduit_channel_after : Nat → IO (Channel Unit)
+ *
+ * Channel that delivers one value after ms milliseconds, then closes.
+ */
+LEAN_EXPORT lean_obj_res conduit_channel_after(
+    b_lean_obj_arg ms_obj,
+    lean_obj_arg world
+) {
+    size_t ms = lean_usize_of_nat(ms_obj);
 
-    if (timeout_ms == 0) {
-        lean_object *final_inner = lean_ctor_get(result, 0);
-        if (lean_is_scalar(final_inner)) {
-            bool all_send_closed = true;
-            for (size_t i = 0; i < n; i++) {
-                lean_object *pair = lean_array_get_core(cases_obj, i);
-                lean_object *ch_obj = lean_ctor_get(pair, 0);
-                bool is_send = lean_unbox(lean_ctor_get(pair, 1)) != 0;
+    lean_object *result = conduit_channel_new_buffered(lean_box(1), world);
+    if (!lean_io_result_is_ok(result)) {
+        return result;
+    }
+    lean_object *ch_obj = lean_io_result_get_value(result);
 
-                if (!is_send) {
-                    all_send_closed = false;
-                    break;
-                }
+    pthread_once(&g_timer_once, timer_thread_start);
 
-                conduit_channel_t *ch = conduit_channel_unbox(ch_obj);
-                pthread_mutex_lock(&ch->mutex);
-                bool closed = ch->closed;
-                pthread_mutex_unlock(&ch->mutex);
+    lean_inc(ch_obj); /* Timer's reference */
+    if (!timer_add(ch_obj, ms, 0)) {
+        lean_dec(ch_obj);
+        lean_dec(result);
+        return mk_io_error("Failed to allocate timer");
+    }
+    return result;
+}
 
-                if (!closed) {
-                    all_send_closed = false;
-                    break;
-                }
-            }
+/*
+ * conduit_channel_ticker : Nat → IO (Channel Unit)
+ *
+ * Channel that delivers a value every ms milliseconds (clamped to >= 1).
+ * Close the channel to stop the ticker and release its timer.
+ */
+LEAN_EXPORT lean_obj_res conduit_channel_ticker(
+    b_lean_obj_arg ms_obj,
+    lean_obj_arg world
+) {
+    size_t ms = lean_usize_of_nat(ms_obj);
+    if (ms == 0) {
+        ms = 1;
+    }
 
-            if (!all_send_closed) {
-                lean_dec(result);
-                goto retry;
-            }
-        }
+    lean_object *result = conduit_channel_new_buffered(lean_box(1), world);
+    if (!lean_io_result_is_ok(result)) {
+        return result;
     }
+    lean_object *ch_obj = lean_io_result_get_value(result);
+
+    pthread_once(&g_timer_once, timer_thread_start);
 
+    lean_inc(ch_obj); /* Timer's reference */
+    if (!timer_add(ch_obj, ms, ms)) {
+        lean_dec(ch_obj);
+        lean_dec(result);
+        return mk_io_error("Failed to allocate timer");
+    }
     return result;
 }
 
 /* ============================================================================
- * Allocation Statistics (for testing finalizers and memory leaks)
+ * Timing (for the benchmark harness)
  * ============================================================================ */
 
 /*
- * conduit_get_alloc_stats : IO (Int × Int)
- *
- * Returns (alloc_count, free_count) for testing that finalizers run correctly.
- */
-LEAN_EXPORT lean_obj_res conduit_get_alloc_stats(lean_obj_arg world) {
-    (void)world;
-    int64_t allocs = atomic_load(&g_channel_alloc_count);
-    int64_t frees = atomic_load(&g_channel_free_count);
-    /* Return tuple (allocs, frees) as (Nat, Nat) */
-    lean_object *pair = lean_alloc_ctor(0, 2, 0);
-    lean_ctor_set(pair, 0, lean_uint64_to_nat((uint64_t)allocs));
-    lean_ctor_set(pair, 1, lean_uint64_to_nat((uint64_t)frees));
-    return lean_io_result_mk_ok(pair);
-}
-
-/*
- * conduit_reset_alloc_stats : IO Unit
+ * conduit_monotonic_nanos : IO UInt64
  *
- * Resets allocation counters to zero (useful between tests).
+ * Monotonic clock in nanoseconds. Not affected by NTP steps; suitable
+ * for measuring intervals.
  */
-LEAN_EXPORT lean_obj_res conduit_reset_alloc_stats(lean_obj_arg world) {
+LEAN_EXPORT lean_obj_res conduit_monotonic_nanos(lean_obj_arg world) {
     (void)world;
-    atomic_store(&g_channel_alloc_count, 0);
-    atomic_store(&g_channel_free_count, 0);
-    return lean_io_result_mk_ok(lean_box(0));
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t ns = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    return lean_io_result_mk_ok(lean_box_uint64(ns));
 }